@@ -0,0 +1,57 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <chrono>
+#include <fmt/compile.h>
+#include <fmt/format.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    template<typename F>
+    auto measure(const char* name, F&& function) noexcept -> std::vector<std::string> {
+        const auto start = std::chrono::steady_clock::now();
+        auto result = function();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        fmt::print("{:<10} {:>8.2f} ms\n", name,
+                   std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(elapsed).count());
+        return result;
+    }
+}// namespace
+
+// Compares mappers::format with a runtime format string against the same format compiled with FMT_COMPILE
+auto main() -> int {
+    using namespace kstd::streams;
+
+    constexpr kstd::usize count = 1000000;
+    std::vector<kstd::u32> values(count);
+    for(kstd::usize index = 0; index < count; ++index) {
+        values[index] = static_cast<kstd::u32>(index * 2654435761U);
+    }
+
+    const auto runtime_values = measure("runtime", [&values]() noexcept {
+        return stream(values).map(mappers::format("{:>12}")).collect<std::vector>(collectors::push_back);
+    });
+    const auto compiled_values = measure("compiled", [&values]() noexcept {
+        return stream(values).map(mappers::format(FMT_COMPILE("{:>12}"))).collect<std::vector>(collectors::push_back);
+    });
+    return runtime_values == compiled_values ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kstd::streams {
+    // Type-erased pipe. The erased pipe is kept inline when it is small enough, and elements of prefetchable pipes
+    // (sources, buffered stages and pure stages like map and filter) are pulled through a single virtual call per
+    // batch instead of one per element. Other pipes are pulled one element per call, as pulling ahead would run
+    // their stages early and invalidate elements which borrow from the pipe, like the spans of window() and chunk().
+    template<typename T>
+    struct AnyPipe final {
+        // clang-format off
+        using ValueType     = T;
+        using Self          = AnyPipe<ValueType>;
+        using StorageType   = std::conditional_t<
+                                std::is_lvalue_reference_v<ValueType>,
+                                std::remove_reference_t<ValueType>*,
+                                ValueType>;
+        using BatchType     = std::vector<StorageType>;
+        // clang-format on
+
+        static constexpr usize batch_size = 64;
+        static constexpr usize inline_size = 64;
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = false;
+
+        private:
+        struct Source {
+            virtual ~Source() noexcept = default;
+            virtual auto get_next() noexcept -> Option<ValueType> = 0;
+            virtual auto fill(BatchType& batch) noexcept -> void = 0;
+            virtual auto move_to(void* address) noexcept -> Source* = 0;
+        };
+
+        template<typename PIPE>
+        struct Model final : Source {
+            PIPE pipe;
+
+            explicit Model(PIPE pipe) noexcept :
+                    pipe {std::move(pipe)} {
+            }
+
+            auto get_next() noexcept -> Option<ValueType> override {
+                auto element = pipe.get_next();
+                if(!element) {
+                    return {};
+                }
+                if constexpr(std::is_lvalue_reference_v<ValueType>) {
+                    return *element;
+                }
+                else {
+                    return std::move(*element);
+                }
+            }
+
+            auto fill(BatchType& batch) noexcept -> void override {
+                batch.clear();
+                while(batch.size() < batch_size) {
+                    auto element = pipe.get_next();
+                    if(!element) {
+                        break;
+                    }
+                    if constexpr(std::is_lvalue_reference_v<ValueType>) {
+                        batch.push_back(&(*element));
+                    }
+                    else {
+                        batch.push_back(std::move(*element));
+                    }
+                }
+            }
+
+            auto move_to(void* address) noexcept -> Source* override {
+                return ::new(address) Model {std::move(pipe)};
+            }
+        };
+
+        template<typename PIPE>
+        static constexpr bool fits_inline = sizeof(Model<PIPE>) <= inline_size &&
+                                            alignof(Model<PIPE>) <= alignof(std::max_align_t) &&
+                                            std::is_nothrow_move_constructible_v<PIPE>;
+
+        alignas(std::max_align_t) std::array<std::byte, inline_size> _inline;
+        Source* _source;
+        BatchType _batch;
+        usize _index;
+        bool _is_batched;
+
+        [[nodiscard]] auto is_inline() const noexcept -> bool {
+            return static_cast<const void*>(_source) == static_cast<const void*>(_inline.data());
+        }
+
+        auto reset() noexcept -> void {
+            if(_source == nullptr) {
+                return;
+            }
+            if(is_inline()) {
+                std::destroy_at(_source);
+            }
+            else {
+                delete _source;
+            }
+            _source = nullptr;
+        }
+
+        auto take(Self& other) noexcept -> void {
+            if(other._source != nullptr && other.is_inline()) {
+                _source = other._source->move_to(_inline.data());
+                other.reset();
+            }
+            else {
+                _source = std::exchange(other._source, nullptr);
+            }
+            _batch = std::move(other._batch);
+            _index = std::exchange(other._index, 0);
+            _is_batched = other._is_batched;
+            other._batch.clear();
+        }
+
+        public:
+        KSTD_NO_COPY(AnyPipe, Self)
+
+        AnyPipe() noexcept :
+                _inline {},
+                _source {nullptr},
+                _batch {},
+                _index {0},
+                _is_batched {false} {
+        }
+
+        template<typename PIPE>
+            requires(!std::is_same_v<std::remove_cvref_t<PIPE>, Self>)
+        explicit AnyPipe(PIPE pipe) noexcept :
+                _inline {},
+                _source {nullptr},
+                _batch {},
+                _index {0},
+                _is_batched {PIPE::is_prefetchable} {
+            if constexpr(fits_inline<PIPE>) {
+                _source = ::new(_inline.data()) Model<PIPE> {std::move(pipe)};
+            }
+            else {
+                _source = new Model<PIPE> {std::move(pipe)};
+            }
+            if constexpr(PIPE::is_prefetchable) {
+                _batch.reserve(batch_size);
+            }
+        }
+
+        AnyPipe(Self&& other) noexcept :
+                _inline {},
+                _source {nullptr},
+                _batch {},
+                _index {0},
+                _is_batched {false} {
+            take(other);
+        }
+
+        ~AnyPipe() noexcept {
+            reset();
+        }
+
+        auto operator=(Self&& other) noexcept -> Self& {
+            if(this != &other) {
+                reset();
+                take(other);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            if(!_is_batched) {
+                if(_source == nullptr) {
+                    return {};
+                }
+                return _source->get_next();
+            }
+            if(_index == _batch.size()) {
+                if(_source == nullptr) {
+                    return {};
+                }
+                _source->fill(_batch);
+                _index = 0;
+                if(_batch.empty()) {
+                    return {};
+                }
+            }
+            if constexpr(std::is_lvalue_reference_v<ValueType>) {
+                return *_batch[_index++];
+            }
+            else {
+                return std::move(_batch[_index++]);
+            }
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,137 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <numbers>
+#include <vector>
+
+#include "hashing.hpp"
+
+namespace kstd::streams {
+    // Blocked Bloom filter, all bits of an element live in the same cache line so a lookup touches one line only.
+    // Built by Stream::collect_bloom_filter(rate), or with an explicit expected count through the container interface
+    // of collect(), e.g. collect<BloomFilter>(collectors::insert, count, rate). Too small a count saturates the filter.
+    template<typename T>
+    struct BloomFilter final {
+        // clang-format off
+        using ValueType     = T;
+        using Self          = BloomFilter<ValueType>;
+        // clang-format on
+
+        static constexpr usize block_bits = 512;
+        static constexpr usize word_bits = 64;
+        static constexpr usize max_hash_count = 16;
+        static constexpr f64 default_false_positive_rate = 0.01;
+
+        struct alignas(block_bits / 8) Block final {
+            std::array<u64, block_bits / word_bits> words;
+        };
+
+        private:
+        std::vector<Block> _blocks;
+        usize _hash_count;
+
+        [[nodiscard]] constexpr auto get_block_index(u64 hash) const noexcept -> usize {
+            return static_cast<usize>(((hash >> 32) * static_cast<u64>(_blocks.size())) >> 32);
+        }
+
+        // Double hashing on the low half, the top 9 bits of every probe select a bit inside the block
+        template<typename F>
+        constexpr auto for_each_bit(u64 hash, F&& function) const noexcept -> bool {
+            const auto first = static_cast<u32>(hash);
+            const auto second = static_cast<u32>(std::rotr(hash, 21)) | 1U;
+            for(usize index = 0; index < _hash_count; ++index) {
+                const auto bit = static_cast<usize>((first + static_cast<u32>(index) * second) >> 23);
+                if(!function(bit / word_bits, u64 {1} << (bit % word_bits))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(BloomFilter, Self)
+
+        explicit BloomFilter(usize expected_count, f64 false_positive_rate = default_false_positive_rate) noexcept :
+                _blocks {},
+                _hash_count {1} {
+            const auto count = static_cast<f64>(std::max<usize>(expected_count, 1));
+            const auto rate = std::clamp(false_positive_rate, 1e-9, 0.5);
+            const auto bit_count = -count * std::log(rate) / (std::numbers::ln2 * std::numbers::ln2);
+            _blocks.resize(std::max<usize>(static_cast<usize>(std::ceil(bit_count / block_bits)), 1), Block {});
+            const auto hash_count = static_cast<usize>(std::round(bit_count / count * std::numbers::ln2));
+            _hash_count = std::clamp<usize>(hash_count, 1, max_hash_count);
+        }
+
+        ~BloomFilter() noexcept = default;
+
+        auto insert(const ValueType& value) noexcept -> void {
+            insert_hash(hashing::hash(value));
+        }
+
+        auto insert_hash(u64 hash) noexcept -> void {
+            auto& block = _blocks[get_block_index(hash)];
+            for_each_bit(hash, [&block](usize word, u64 mask) noexcept -> bool {
+                block.words[word] |= mask;
+                return true;
+            });
+        }
+
+        // May return false positives, never false negatives
+        [[nodiscard]] auto contains(const ValueType& value) const noexcept -> bool {
+            return contains_hash(hashing::hash(value));
+        }
+
+        [[nodiscard]] auto contains_hash(u64 hash) const noexcept -> bool {
+            const auto& block = _blocks[get_block_index(hash)];
+            return for_each_bit(hash, [&block](usize word, u64 mask) noexcept -> bool {
+                return (block.words[word] & mask) != 0;
+            });
+        }
+
+        // Filters can only be merged when they were created with the same parameters
+        auto merge(const Self& other) noexcept -> bool {
+            if(other._blocks.size() != _blocks.size() || other._hash_count != _hash_count) {
+                return false;
+            }
+            for(usize index = 0; index < _blocks.size(); ++index) {
+                for(usize word = 0; word < block_bits / word_bits; ++word) {
+                    _blocks[index].words[word] |= other._blocks[index].words[word];
+                }
+            }
+            return true;
+        }
+
+        [[nodiscard]] auto get_block_count() const noexcept -> usize {
+            return _blocks.size();
+        }
+
+        [[nodiscard]] auto get_hash_count() const noexcept -> usize {
+            return _hash_count;
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -20,12 +20,16 @@
 #pragma once
 
 #include <functional>
+#include <iterator>
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "iterator_pipe.hpp"
+#include "profiling.hpp"
+#include "tracing.hpp"
 
 namespace kstd::streams {
     template<typename PIPE, typename CALLBACK>
@@ -39,39 +43,125 @@ namespace kstd::streams {
         using DelegateIterator  = typename BufferType::iterator;
         using DelegatePipeType  = IteratorPipe<DelegateIterator>;
         using ValueType         = typename DelegatePipeType::ValueType;
+        using ElementType       = typename DelegatePipeType::ElementType;
         // clang-format on
 
+        static constexpr bool is_random_access = true;
+        static constexpr bool is_sized = true;
+        static constexpr bool is_contiguous = true;
+        static constexpr bool is_prefetchable = true;
+
         static_assert(std::is_convertible_v<CallbackType, std::function<void(BufferType&)>>,
                       "Callback signature does not match");
 
         private:
         BufferType _buffer;
         DelegatePipeType _pipe;
+        BufferType* _storage;// Receives the buffer on destruction so the next pipe can reuse its capacity
 
-        public:
-        KSTD_DEFAULT_MOVE_COPY(BufferedPipe, Self, constexpr)
+        constexpr auto release() noexcept -> void {
+            if(_storage != nullptr) {
+                _buffer.clear();
+                std::swap(*_storage, _buffer);
+                _storage = nullptr;
+            }
+        }
 
+        // Points the delegate at the own buffer, at the position the other pipe's delegate reached in its buffer
+        constexpr auto rebind(const Self& other) noexcept -> void {
+            const auto offset = other._buffer.empty() ? 0 : other._buffer.size() - other._pipe.get_source_size();
+            _pipe = DelegatePipeType {std::next(_buffer.begin(), static_cast<isize>(offset)), _buffer.end()};
+        }
+
+        public:
         constexpr BufferedPipe() noexcept :
                 _buffer {},
-                _pipe {} {
+                _pipe {},
+                _storage {nullptr} {
         }
 
-        constexpr BufferedPipe(PipeType pipe, CallbackType callback) noexcept :
-                _buffer {} {
-            auto element = pipe.get_next();
-            while(element) {
-                _buffer.push_back(*element);
-                element = pipe.get_next();
+        constexpr BufferedPipe(PipeType pipe, CallbackType callback, const char* name = "buffered",
+                               BufferType* storage = nullptr) noexcept :
+                _buffer {},
+                _storage {storage} {
+            if(_storage != nullptr) {
+                std::swap(_buffer, *_storage);
+                _buffer.clear();
+            }
+            const tracing::Scope<> stage_scope {name, "buffered"};
+            profiling::StageCounters counters {};
+            {
+                profiling::StageScope<> scope {counters};
+                {
+                    const tracing::Scope<> fill_scope {"fill", "buffered"};
+                    auto element = pipe.get_next();
+                    while(element) {
+                        _buffer.push_back(*element);
+                        element = pipe.get_next();
+                    }
+                }
+                counters.elements_in = _buffer.size();
+                const tracing::Scope<> callback_scope {"callback", "buffered"};
+                callback(_buffer);
             }
-            callback(_buffer);
+            counters.elements_out = _buffer.size();
+            counters.buffer_size = _buffer.capacity();
+            profiling::submit(name, counters);
             _pipe = DelegatePipeType {_buffer.begin(), _buffer.end()};
         }
 
-        ~BufferedPipe() noexcept = default;
+        // Copies never hand their buffer back, only the original does
+        constexpr BufferedPipe(const Self& other) noexcept :
+                _buffer {other._buffer},
+                _pipe {},
+                _storage {nullptr} {
+            rebind(other);
+        }
+
+        constexpr BufferedPipe(Self&& other) noexcept :
+                _buffer {std::move(other._buffer)},
+                _pipe {std::move(other._pipe)},
+                _storage {std::exchange(other._storage, nullptr)} {
+        }
+
+        constexpr ~BufferedPipe() noexcept {
+            release();
+        }
+
+        constexpr auto operator=(const Self& other) noexcept -> Self& {
+            if(this != &other) {
+                release();
+                _buffer = other._buffer;
+                rebind(other);
+            }
+            return *this;
+        }
+
+        constexpr auto operator=(Self&& other) noexcept -> Self& {
+            if(this != &other) {
+                release();
+                _buffer = std::move(other._buffer);
+                _pipe = std::move(other._pipe);
+                _storage = std::exchange(other._storage, nullptr);
+            }
+            return *this;
+        }
 
         [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
             return _pipe.get_next();
         }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            return _pipe.get_source_size();
+        }
+
+        [[nodiscard]] constexpr auto get_data() const noexcept -> ElementType* {
+            return _pipe.get_data();
+        }
+
+        [[nodiscard]] constexpr auto slice(usize offset, usize count) const noexcept -> DelegatePipeType {
+            return _pipe.slice(offset, count);
+        }
     };
 
     namespace {
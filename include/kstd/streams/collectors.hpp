@@ -19,8 +19,13 @@
 
 #pragma once
 
+#include <fmt/compile.h>
+#include <fmt/format.h>
+#include <iterator>
 #include <kstd/defaults.hpp>
 #include <kstd/types.hpp>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace kstd::streams::collectors {
@@ -78,6 +83,16 @@ namespace kstd::streams::collectors {
         result = decltype(result) {result.crbegin(), result.crend()};
     };
 
+    template<typename T>
+    [[nodiscard]] constexpr auto get_joined_length(const T& value) noexcept -> usize {
+        if constexpr(std::is_arithmetic_v<T>) {
+            return 1;
+        }
+        else {
+            return std::size(value);
+        }
+    }
+
     template<typename D>
     [[nodiscard]] constexpr auto joining(D delimiter) noexcept -> decltype(auto) {
         return [delimiter](auto& pipe, auto& result) noexcept -> void {
@@ -86,6 +101,14 @@ namespace kstd::streams::collectors {
             static_assert(std::is_same_v<Type, D>, "Delimiter type must match pipe value type");
 
             auto element = pipe.get_next();
+            if constexpr(PipeType::is_sized) {
+                if(element) {
+                    // Elements are only known one at a time, so the first one stands in for the average length
+                    const auto count = pipe.get_source_size() + 1;
+                    const auto delimiter_length = get_joined_length(delimiter) * (count - 1);
+                    result.reserve(result.size() + (get_joined_length(*element) * count) + delimiter_length);
+                }
+            }
             while(element) {
                 result += *element;
                 element = pipe.get_next();
@@ -95,4 +118,130 @@ namespace kstd::streams::collectors {
             }
         };
     }
+
+    // A runtime format string split around its only replacement field, which lets format_joining parse the field's
+    // format spec once instead of once per element. Anything else is left to fmt::runtime.
+    struct RuntimeFormat final {
+        std::string format;
+        std::string prefix;
+        std::string spec;
+        std::string suffix;
+        bool is_split = false;
+    };
+
+    [[nodiscard]] inline auto split_format(std::string format) noexcept -> RuntimeFormat {
+        RuntimeFormat result {};
+        result.format = std::move(format);
+        const std::string_view source {result.format};
+        auto* literal = &result.prefix;
+        usize fields = 0;
+
+        for(usize index = 0; index < source.size(); ++index) {
+            const auto current = source[index];
+            const auto is_escaped = index + 1 < source.size() && source[index + 1] == current;
+            if(current != '{' && current != '}') {
+                literal->push_back(current);
+                continue;
+            }
+            if(is_escaped) {
+                literal->push_back(current);
+                ++index;
+                continue;
+            }
+            const auto end = source.find('}', index);
+            if(current == '}' || end == std::string_view::npos || ++fields > 1) {
+                return result;
+            }
+            const auto field = source.substr(index + 1, end - index - 1);
+            const auto colon = field.find(':');
+            const auto id = field.substr(0, colon);
+            if((!id.empty() && id != "0") || field.find('{') != std::string_view::npos) {
+                return result;// Named fields and dynamic width or precision need more than one argument
+            }
+            if(colon != std::string_view::npos) {
+                result.spec = field.substr(colon + 1);
+            }
+            literal = &result.suffix;
+            index = end;
+        }
+
+        result.is_split = fields == 1;
+        return result;
+    }
+
+    template<typename T, typename F>
+    class ElementFormatter final {
+        const F& _format;
+
+        public:
+        explicit ElementFormatter(const F& format) noexcept :
+                _format(format) {
+        }
+
+        auto append(fmt::memory_buffer& buffer, const T& value) noexcept -> void {
+            fmt::format_to(std::back_inserter(buffer), _format, value);
+        }
+    };
+
+    template<typename T>
+    class ElementFormatter<T, RuntimeFormat> final {
+        const RuntimeFormat& _format;
+        fmt::formatter<T> _formatter {};
+        bool _is_parsed = false;
+
+        public:
+        explicit ElementFormatter(const RuntimeFormat& format) noexcept :
+                _format(format) {
+            if(format.is_split) {
+                fmt::format_parse_context context {format.spec};
+                _is_parsed = _formatter.parse(context) == context.end();
+            }
+        }
+
+        auto append(fmt::memory_buffer& buffer, const T& value) noexcept -> void {
+            if(!_is_parsed) {
+                fmt::format_to(std::back_inserter(buffer), fmt::runtime(_format.format), value);
+                return;
+            }
+            buffer.append(_format.prefix.data(), _format.prefix.data() + _format.prefix.size());
+            fmt::format_context context {fmt::appender(buffer), fmt::format_args {}};
+            context.advance_to(_formatter.format(value, context));
+            buffer.append(_format.suffix.data(), _format.suffix.data() + _format.suffix.size());
+        }
+    };
+
+    // Formats every element straight into one memory buffer and appends it to the result with a single allocation,
+    // the result may be any container with an append(first, last) member like std::string. The format may also be
+    // compiled with FMT_COMPILE.
+    template<typename S = std::string>
+    [[nodiscard]] constexpr auto format_joining(S format, std::string delimiter) noexcept -> decltype(auto) {
+        using FormatType = std::conditional_t<std::is_convertible_v<S, std::string>, RuntimeFormat, S>;
+        auto parsed_format = [&]() noexcept -> FormatType {
+            if constexpr(std::is_same_v<FormatType, RuntimeFormat>) {
+                return split_format(std::string {std::move(format)});
+            }
+            else {
+                return std::move(format);
+            }
+        }();
+
+        return [format = std::move(parsed_format), delimiter = std::move(delimiter)](auto& pipe,
+                                                                                    auto& result) noexcept -> void {
+            using PipeType = std::remove_reference_t<decltype(pipe)>;
+            using Type = std::remove_cvref_t<typename PipeType::ValueType>;
+            ElementFormatter<Type, FormatType> formatter {format};
+            fmt::memory_buffer buffer {};
+            auto element = pipe.get_next();
+            if(element) {
+                formatter.append(buffer, *element);
+                element = pipe.get_next();
+            }
+            while(element) {
+                buffer.append(delimiter.data(), delimiter.data() + delimiter.size());
+                formatter.append(buffer, *element);
+                element = pipe.get_next();
+            }
+            result.append(buffer.data(), buffer.data() + buffer.size());
+        };
+    }
 }// namespace kstd::streams::collectors
\ No newline at end of file
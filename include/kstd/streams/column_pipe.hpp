@@ -0,0 +1,132 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+#include "iterator_pipe.hpp"
+
+namespace kstd::streams {
+    // Lightweight proxy for one row of a struct-of-arrays layout, columns are only read when accessed
+    template<typename... TYPES>
+    struct ColumnRow final {
+        // clang-format off
+        using Self          = ColumnRow<TYPES...>;
+        using PointerTuple  = std::tuple<TYPES*...>;
+        // clang-format on
+
+        private:
+        PointerTuple _columns;
+        usize _index;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(ColumnRow, Self, constexpr)
+
+        constexpr ColumnRow(PointerTuple columns, usize index) noexcept :
+                _columns {columns},
+                _index {index} {
+        }
+
+        ~ColumnRow() noexcept = default;
+
+        template<usize INDEX>
+        [[nodiscard]] constexpr auto get() const noexcept -> std::tuple_element_t<INDEX, std::tuple<TYPES...>>& {
+            return std::get<INDEX>(_columns)[_index];
+        }
+
+        [[nodiscard]] constexpr auto get_index() const noexcept -> usize {
+            return _index;
+        }
+    };
+
+    template<typename... TYPES>
+    struct ColumnPipe final {
+        // clang-format off
+        using Self          = ColumnPipe<TYPES...>;
+        using ValueType     = ColumnRow<TYPES...>;
+        using PointerTuple  = std::tuple<TYPES*...>;
+        // clang-format on
+
+        static constexpr bool is_random_access = true;
+        static constexpr bool is_sized = true;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = true;
+
+        private:
+        PointerTuple _columns;
+        usize _current;
+        usize _end;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(ColumnPipe, Self, constexpr)
+
+        constexpr ColumnPipe() noexcept :
+                _columns {},
+                _current {0},
+                _end {0} {
+        }
+
+        constexpr ColumnPipe(PointerTuple columns, usize begin, usize end) noexcept :
+                _columns {columns},
+                _current {begin},
+                _end {end} {
+        }
+
+        ~ColumnPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            if(_current == _end) {
+                return {};
+            }
+            return ValueType {_columns, _current++};
+        }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            return _end - _current;
+        }
+
+        [[nodiscard]] constexpr auto slice(usize offset, usize count) const noexcept -> Self {
+            return {_columns, _current + offset, _current + offset + count};
+        }
+
+        // Projects the remaining rows onto a single column, which is contiguous again
+        template<usize INDEX>
+        [[nodiscard]] constexpr auto get_column() const noexcept -> decltype(auto) {
+            using ElementType = std::tuple_element_t<INDEX, std::tuple<TYPES...>>;
+            using Iterator = typename std::span<ElementType>::iterator;
+            const std::span<ElementType> column {std::get<INDEX>(_columns) + _current, _end - _current};
+            return IteratorPipe<Iterator> {column.begin(), column.end()};
+        }
+    };
+}// namespace kstd::streams
+
+template<typename... TYPES>
+struct std::tuple_size<kstd::streams::ColumnRow<TYPES...>> : std::integral_constant<std::size_t, sizeof...(TYPES)> {};
+
+template<std::size_t INDEX, typename... TYPES>
+struct std::tuple_element<INDEX, kstd::streams::ColumnRow<TYPES...>> {
+    using type = std::tuple_element_t<INDEX, std::tuple<TYPES...>>&;
+};
\ No newline at end of file
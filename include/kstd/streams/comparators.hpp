@@ -20,6 +20,14 @@
 #pragma once
 
 namespace kstd::streams::comparators {
+    constexpr auto less_than = [](const auto& lhs, const auto& rhs) noexcept -> bool {
+        return lhs < rhs;
+    };
+
+    constexpr auto greater_than = [](const auto& lhs, const auto& rhs) noexcept -> bool {
+        return lhs > rhs;
+    };
+
     constexpr auto deref_less_than = [](auto* lhs, auto* rhs) noexcept -> bool {
         return (*lhs) < (*rhs);
     };
@@ -0,0 +1,73 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <utility>
+
+namespace kstd::streams {
+    // Drops adjacent duplicates, only the last emitted element is kept around
+    template<typename PIPE>
+    struct DistinctSortedPipe final {
+        // clang-format off
+        using PipeType  = PIPE;
+        using Self      = DistinctSortedPipe<PipeType>;
+        using ValueType = typename PipeType::ValueType;
+        // clang-format on
+
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = PipeType::is_prefetchable;
+
+        private:
+        PipeType _pipe;
+        Option<ValueType> _last;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(DistinctSortedPipe, Self, constexpr)
+
+        constexpr DistinctSortedPipe() noexcept :
+                _pipe {},
+                _last {} {
+        }
+
+        explicit constexpr DistinctSortedPipe(PipeType pipe) noexcept :
+                _pipe {std::move(pipe)},
+                _last {} {
+        }
+
+        ~DistinctSortedPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            auto element = _pipe.get_next();
+            while(element && _last && *element == *_last) {
+                element = _pipe.get_next();
+            }
+            if(element) {
+                _last = element;
+            }
+            return element;
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,79 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <type_traits>
+
+#include "zip_pipe.hpp"
+
+namespace kstd::streams {
+    template<typename PIPE>
+    struct EnumeratePipe final {
+        // clang-format off
+        using PipeType      = PIPE;
+        using Self          = EnumeratePipe<PipeType>;
+        using ValueType     = Zipped<usize, typename PipeType::ValueType>;
+        // clang-format on
+
+        static constexpr bool is_sized = PipeType::is_sized;
+        static constexpr bool is_random_access = is_sized;// Indices only line up with slices on sized pipes
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = PipeType::is_prefetchable;
+
+        private:
+        PipeType _pipe;
+        usize _index;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(EnumeratePipe, Self, constexpr)
+
+        constexpr EnumeratePipe() noexcept :
+                _pipe {},
+                _index {0} {
+        }
+
+        constexpr EnumeratePipe(PipeType pipe, usize index) noexcept :
+                _pipe {std::move(pipe)},
+                _index {index} {
+        }
+
+        ~EnumeratePipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            auto element = _pipe.get_next();
+            if(!element) {
+                return {};
+            }
+            return ValueType {_index++, std::forward<typename PipeType::ValueType>(*element)};
+        }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            return _pipe.get_source_size();
+        }
+
+        [[nodiscard]] constexpr auto slice(usize offset, usize count) const noexcept -> decltype(auto) {
+            using SlicedPipe = std::remove_cv_t<decltype(_pipe.slice(offset, count))>;
+            return EnumeratePipe<SlicedPipe> {_pipe.slice(offset, count), _index + offset};
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,209 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "profiling.hpp"
+#include "tracing.hpp"
+
+namespace kstd::streams {
+    template<typename PIPE, typename COMPARATOR, typename SERIALIZER>
+    struct ExternalSortPipe final {
+        // clang-format off
+        using PipeType          = PIPE;
+        using ComparatorType    = COMPARATOR;
+        using SerializerType    = SERIALIZER;
+        using Self              = ExternalSortPipe<PipeType, ComparatorType, SerializerType>;
+        using ValueType         = std::remove_cv_t<std::remove_reference_t<typename PipeType::ValueType>>;
+        using BufferType        = std::vector<ValueType>;
+        // clang-format on
+
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = true;
+
+        static_assert(std::is_default_constructible_v<ValueType>, "Value type must be default constructible");
+
+        private:
+        struct FileDeleter final {
+            auto operator()(std::FILE* file) const noexcept -> void {
+                std::fclose(file);
+            }
+        };
+
+        using FileHandle = std::unique_ptr<std::FILE, FileDeleter>;
+
+        // A sorted run, spilled to a temporary file unless everything fits into memory at once
+        struct Run final {
+            FileHandle file;
+            BufferType buffer;
+            usize position;
+        };
+
+        ComparatorType _comparator;
+        SerializerType _serializer;
+        usize _max_elements;
+        bool* _failed;
+        std::vector<Run> _runs;
+        std::vector<usize> _heap;
+
+        auto fail() noexcept -> void {
+            _runs.clear();
+            _heap.clear();
+            if(_failed != nullptr) {
+                *_failed = true;
+            }
+        }
+
+        [[nodiscard]] auto get_heap_comparator() noexcept -> decltype(auto) {
+            return [this](usize lhs, usize rhs) noexcept -> bool {
+                const auto& lhs_run = _runs[lhs];
+                const auto& rhs_run = _runs[rhs];
+                return _comparator(rhs_run.buffer[rhs_run.position], lhs_run.buffer[lhs_run.position]);
+            };
+        }
+
+        [[nodiscard]] auto spill(BufferType& buffer) noexcept -> bool {
+            const tracing::Scope<> scope {"spill", "buffered"};
+            std::sort(buffer.begin(), buffer.end(), _comparator);
+            FileHandle file {std::tmpfile()};
+            if(!file || !_serializer.write(file.get(), buffer.data(), buffer.size()) || std::fflush(file.get()) != 0) {
+                return false;
+            }
+            std::rewind(file.get());
+            _runs.push_back({std::move(file), {}, 0});
+            buffer.clear();
+            return true;
+        }
+
+        [[nodiscard]] auto refill(Run& run) noexcept -> bool {
+            if(!run.file) {
+                if(run.position < run.buffer.size()) {
+                    return true;
+                }
+                run.buffer = {};
+                return false;
+            }
+            const auto block_size = std::max<usize>(_max_elements / _runs.size(), 1);
+            run.buffer.resize(block_size);
+            const auto count = _serializer.read(run.file.get(), run.buffer.data(), block_size);
+            // Short reads are only fine at the end of the run, anything else means the run was not read back intact
+            if(!count || std::ferror(run.file.get()) != 0 || (*count < block_size && std::feof(run.file.get()) == 0)) {
+                fail();
+                return false;
+            }
+            run.buffer.resize(*count);
+            run.position = 0;
+            if(run.buffer.empty()) {
+                run.file.reset();
+                run.buffer = {};
+                return false;
+            }
+            return true;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(ExternalSortPipe, Self)
+
+        ExternalSortPipe() noexcept :
+                _comparator {},
+                _serializer {},
+                _max_elements {0},
+                _failed {nullptr},
+                _runs {},
+                _heap {} {
+        }
+
+        ExternalSortPipe(PipeType pipe, usize max_memory, ComparatorType comparator, SerializerType serializer,
+                         bool* failed) noexcept :
+                _comparator {std::move(comparator)},
+                _serializer {std::move(serializer)},
+                _max_elements {std::max<usize>(max_memory / sizeof(ValueType), 1)},
+                _failed {failed},
+                _runs {},
+                _heap {} {
+            const tracing::Scope<> stage_scope {"sort_external", "buffered"};
+            profiling::StageCounters counters {};
+            {
+                profiling::StageScope<> scope {counters};
+                // Reserve up front, growing by push_back could allocate up to twice the budget
+                BufferType buffer {};
+                buffer.reserve(_max_elements);
+                auto element = pipe.get_next();
+                while(element) {
+                    buffer.push_back(*element);
+                    ++counters.elements_in;
+                    if(buffer.size() == _max_elements && !spill(buffer)) {
+                        fail();
+                        return;
+                    }
+                    element = pipe.get_next();
+                }
+
+                if(_runs.empty()) {
+                    std::sort(buffer.begin(), buffer.end(), _comparator);
+                    _runs.push_back({nullptr, std::move(buffer), 0});
+                }
+                else if(!buffer.empty() && !spill(buffer)) {
+                    fail();
+                    return;
+                }
+            }
+            counters.elements_out = counters.elements_in;
+            counters.buffer_size = _max_elements;
+            profiling::submit("sort_external", counters);
+
+            for(usize index = 0; index < _runs.size(); ++index) {
+                if(refill(_runs[index])) {
+                    _heap.push_back(index);
+                }
+            }
+            std::make_heap(_heap.begin(), _heap.end(), get_heap_comparator());
+        }
+
+        ~ExternalSortPipe() noexcept = default;
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            if(_heap.empty()) {
+                return {};
+            }
+            const auto comparator = get_heap_comparator();
+            std::pop_heap(_heap.begin(), _heap.end(), comparator);
+            auto& run = _runs[_heap.back()];
+            ValueType result = std::move(run.buffer[run.position++]);
+            if(run.position < run.buffer.size() || refill(run)) {
+                std::push_heap(_heap.begin(), _heap.end(), comparator);
+            }
+            else if(!_heap.empty()) {// Reading a run back may have failed, which drops all runs
+                _heap.pop_back();
+            }
+            return result;
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -21,6 +21,7 @@
 
 #include <kstd/option.hpp>
 #include <type_traits>
+#include <utility>
 
 namespace kstd::streams::filters {
     constexpr auto non_zero = [](auto value) noexcept -> bool {
@@ -43,4 +44,33 @@ namespace kstd::streams::filters {
         static_assert(std::is_integral_v<decltype(value)>);
         return (value & 1) == 0;
     };
+
+    // Marks a predicate as free of state and side effects, so it may be evaluated ahead of the consumer
+    template<typename F>
+    struct Pure final {
+        F predicate;
+
+        template<typename T>
+        [[nodiscard]] constexpr auto operator()(T&& value) const noexcept -> bool {
+            return predicate(std::forward<T>(value));
+        }
+    };
+
+    template<typename F>
+    [[nodiscard]] constexpr auto pure(F predicate) noexcept -> Pure<F> {
+        return {std::move(predicate)};
+    }
+
+    template<typename F>
+    constexpr bool is_marked_pure = false;
+
+    template<typename F>
+    constexpr bool is_marked_pure<Pure<F>> = true;
+
+    // Built-in filters have no state and no side effects, other predicates have to be marked with pure()
+    template<typename F>
+    constexpr bool is_pure = std::is_same_v<std::remove_cv_t<F>, std::remove_cv_t<decltype(non_zero)>> ||
+                             std::is_same_v<std::remove_cv_t<F>, std::remove_cv_t<decltype(odd)>> ||
+                             std::is_same_v<std::remove_cv_t<F>, std::remove_cv_t<decltype(even)>> ||
+                             is_marked_pure<std::remove_cv_t<F>>;
 }// namespace kstd::streams::filters
\ No newline at end of file
@@ -0,0 +1,60 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <bit>
+#include <functional>
+#include <kstd/types.hpp>
+#include <limits>
+#include <type_traits>
+
+namespace kstd::streams::hashing {
+    // MurmurHash3 finalizer, spreads weak hashes (like the identity hash of integers) across all 64 bits
+    [[nodiscard]] constexpr auto mix(u64 value) noexcept -> u64 {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDULL;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr auto hash(const T& value) noexcept -> u64 {
+        if constexpr(std::is_integral_v<T> || std::is_enum_v<T>) {
+            return mix(static_cast<u64>(value));
+        }
+        else if constexpr(std::is_floating_point_v<T> && (sizeof(T) == sizeof(u32) || sizeof(T) == sizeof(u64))) {
+            using BitsType = std::conditional_t<sizeof(T) == sizeof(u32), u32, u64>;
+            // -0.0 == +0.0 has to hash equally, and every NaN is mapped to the same bit pattern
+            if(value == T {0}) {
+                return mix(0);
+            }
+            if(value != value) {
+                return mix(static_cast<u64>(std::bit_cast<BitsType>(std::numeric_limits<T>::quiet_NaN())));
+            }
+            return mix(static_cast<u64>(std::bit_cast<BitsType>(value)));
+        }
+        else {
+            return mix(static_cast<u64>(std::hash<T> {}(value)));
+        }
+    }
+}// namespace kstd::streams::hashing
\ No newline at end of file
@@ -0,0 +1,115 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <span>
+#include <vector>
+
+#include "hashing.hpp"
+
+namespace kstd::streams {
+    // Cardinality sketch using 2^precision one byte registers, the relative error is about 1.04 / sqrt(2^precision)
+    class HyperLogLog final {
+        u8 _precision;
+        std::vector<u8> _registers;
+
+        [[nodiscard]] static constexpr auto get_alpha(usize register_count) noexcept -> f64 {
+            switch(register_count) {
+                case 16: return 0.673;
+                case 32: return 0.697;
+                case 64: return 0.709;
+                default: return 0.7213 / (1.0 + (1.079 / static_cast<f64>(register_count)));
+            }
+        }
+
+        public:
+        static constexpr u8 min_precision = 4;
+        static constexpr u8 max_precision = 18;
+        static constexpr u8 default_precision = 14;
+
+        KSTD_DEFAULT_MOVE_COPY(HyperLogLog, HyperLogLog)
+
+        explicit HyperLogLog(u8 precision = default_precision) noexcept :
+                _precision {std::clamp(precision, min_precision, max_precision)},
+                _registers(usize {1} << _precision, 0) {
+        }
+
+        // Restores a sketch from registers previously obtained through get_registers()
+        HyperLogLog(u8 precision, std::span<const u8> registers) noexcept :
+                HyperLogLog {precision} {
+            std::copy_n(registers.begin(), std::min(registers.size(), _registers.size()), _registers.begin());
+        }
+
+        ~HyperLogLog() noexcept = default;
+
+        template<typename T>
+        auto add(const T& value) noexcept -> void {
+            add_hash(hashing::hash(value));
+        }
+
+        auto add_hash(u64 hash) noexcept -> void {
+            const auto index = static_cast<usize>(hash >> (64 - _precision));
+            // The guard bit caps the rank for hashes whose remaining bits are all zero
+            const auto remainder = (hash << _precision) | (u64 {1} << (_precision - 1));
+            const auto rank = static_cast<u8>(std::countl_zero(remainder) + 1);
+            _registers[index] = std::max(_registers[index], rank);
+        }
+
+        // Sketches can only be merged when they were created with the same precision
+        auto merge(const HyperLogLog& other) noexcept -> bool {
+            if(other._precision != _precision) {
+                return false;
+            }
+            for(usize index = 0; index < _registers.size(); ++index) {
+                _registers[index] = std::max(_registers[index], other._registers[index]);
+            }
+            return true;
+        }
+
+        [[nodiscard]] auto get_estimate() const noexcept -> f64 {
+            const auto register_count = static_cast<f64>(_registers.size());
+            f64 sum = 0.0;
+            usize zero_count = 0;
+            for(const auto value : _registers) {
+                sum += std::ldexp(1.0, -static_cast<i32>(value));
+                zero_count += value == 0 ? 1 : 0;
+            }
+            const auto estimate = get_alpha(_registers.size()) * register_count * register_count / sum;
+            if(estimate <= 2.5 * register_count && zero_count != 0) {
+                return register_count * std::log(register_count / static_cast<f64>(zero_count));
+            }
+            return estimate;
+        }
+
+        [[nodiscard]] auto get_precision() const noexcept -> u8 {
+            return _precision;
+        }
+
+        [[nodiscard]] auto get_registers() const noexcept -> std::span<const u8> {
+            return _registers;
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -19,24 +19,35 @@
 
 #pragma once
 
+#include <iterator>
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
+#include <memory>
+#include <type_traits>
 
 namespace kstd::streams {
     template<typename ITERATOR>
     struct IteratorPipe final {
         // clang-format off
         using Iterator      = ITERATOR;
+        using Traits        = std::iterator_traits<Iterator>;
         using Self          = IteratorPipe<Iterator>;
         using ValueType     = std::conditional_t<
-                                std::is_pointer_v<typename Iterator::value_type>,
-                                typename Iterator::value_type,
+                                std::is_pointer_v<typename Traits::value_type>,
+                                typename Traits::value_type,
                                 std::conditional_t<
-                                    std::is_const_v<std::remove_pointer_t<typename Iterator::pointer>>,
-                                    const std::remove_cv_t<std::remove_reference_t<typename Iterator::value_type>>&,
-                                    std::remove_cv_t<std::remove_reference_t<typename Iterator::value_type>>&>>;
+                                    std::is_const_v<std::remove_pointer_t<typename Traits::pointer>>,
+                                    const std::remove_cv_t<std::remove_reference_t<typename Traits::value_type>>&,
+                                    std::remove_cv_t<std::remove_reference_t<typename Traits::value_type>>&>>;
+        using ElementType   = std::remove_reference_t<decltype(*std::declval<Iterator>())>;
         // clang-format on
 
+        static constexpr bool is_random_access = std::is_base_of_v<
+                std::random_access_iterator_tag, typename Traits::iterator_category>;
+        static constexpr bool is_sized = is_random_access;
+        static constexpr bool is_contiguous = std::contiguous_iterator<Iterator>;
+        static constexpr bool is_prefetchable = std::forward_iterator<Iterator>;// Input iterators reuse their element
+
         private:
         Iterator _current;
         Iterator _end;
@@ -60,7 +71,7 @@ namespace kstd::streams {
             if(_current == _end) {
                 return {};
             }
-            if constexpr(std::is_const_v<std::remove_pointer_t<typename Iterator::pointer>>) {
+            if constexpr(std::is_const_v<std::remove_pointer_t<typename Traits::pointer>>) {
                 ValueType result = *_current;
                 _current = std::next(_current);
                 return result;
@@ -69,6 +80,22 @@ namespace kstd::streams {
                 return *(_current++);
             }
         }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            static_assert(is_random_access, "Pipe source is not random access");
+            return static_cast<usize>(_end - _current);
+        }
+
+        [[nodiscard]] constexpr auto get_data() const noexcept -> ElementType* {
+            static_assert(is_contiguous, "Pipe source is not contiguous");
+            return std::to_address(_current);
+        }
+
+        [[nodiscard]] constexpr auto slice(usize offset, usize count) const noexcept -> Self {
+            static_assert(is_random_access, "Pipe source is not random access");
+            const auto begin = _current + static_cast<typename Traits::difference_type>(offset);
+            return {begin, begin + static_cast<typename Traits::difference_type>(count)};
+        }
     };
 
     static_assert(std::is_same_v<typename IteratorPipe<typename std::vector<std::string>::iterator>::ValueType,
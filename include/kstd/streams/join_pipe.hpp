@@ -0,0 +1,220 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hashing.hpp"
+#include "profiling.hpp"
+#include "tracing.hpp"
+#include "zip_pipe.hpp"
+
+namespace kstd::streams {
+    enum class JoinKind : u8 {
+        INNER,
+        SEMI,
+        ANTI
+    };
+
+    // Hash join, the build side is collected into a flat open-addressing table up front and the probe side is
+    // streamed through it lazily. Matches for the same key are yielded in the order of the build side.
+    // The build pipe is kept alive with the join, as referenced build elements may live in its buffer (e.g. sort()).
+    template<typename PIPE, typename BUILD, typename PROBE_KEY, typename BUILD_KEY, JoinKind KIND>
+    struct JoinPipe final {
+        // clang-format off
+        using PipeType              = PIPE;
+        using BuildPipeType         = BUILD;
+        using ProbeKeyMapper        = PROBE_KEY;
+        using BuildKeyMapper        = BUILD_KEY;
+        using Self                  = JoinPipe<PipeType, BuildPipeType, ProbeKeyMapper, BuildKeyMapper, KIND>;
+        using ProbeValueType        = typename PipeType::ValueType;
+        using BuildValueType        = typename BuildPipeType::ValueType;
+        using NakedBuildValueType   = std::remove_cv_t<std::remove_reference_t<BuildValueType>>;
+        // Build elements which live outside of the stream are referenced, everything else is kept by value
+        using MatchType             = std::conditional_t<
+                                        std::is_lvalue_reference_v<BuildValueType>,
+                                        BuildValueType,
+                                        NakedBuildValueType>;
+        using StorageType           = std::conditional_t<
+                                        std::is_lvalue_reference_v<BuildValueType>,
+                                        std::remove_reference_t<BuildValueType>*,
+                                        NakedBuildValueType>;
+        using ElementType           = std::remove_reference_t<MatchType>;
+        using KeyType               = std::remove_cv_t<std::remove_reference_t<
+                                        std::invoke_result_t<const BuildKeyMapper&, ElementType&>>>;
+        using ValueType             = std::conditional_t<
+                                        KIND == JoinKind::INNER,
+                                        Zipped<ProbeValueType, MatchType>,
+                                        ProbeValueType>;
+        // clang-format on
+
+        static constexpr usize npos = std::numeric_limits<usize>::max();
+        static constexpr usize min_slot_count = 16;
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = PipeType::is_prefetchable;
+
+        private:
+        PipeType _pipe;
+        BuildPipeType _build;
+        ProbeKeyMapper _probe_key;
+        std::vector<StorageType> _values;
+        std::vector<KeyType> _keys;
+        std::vector<usize> _next;// Next build index with the same key, npos terminated
+        std::vector<std::pair<usize, usize>> _slots;// (hash, first build index) with linear probing
+        usize _mask;
+        Option<ProbeValueType> _current;
+        usize _match;
+
+        [[nodiscard]] static constexpr auto get_hash(const KeyType& key) noexcept -> usize {
+            return static_cast<usize>(hashing::hash(key));
+        }
+
+        [[nodiscard]] constexpr auto get_element(usize index) noexcept -> ElementType& {
+            if constexpr(std::is_lvalue_reference_v<BuildValueType>) {
+                return *_values[index];
+            }
+            else {
+                return _values[index];
+            }
+        }
+
+        template<typename K>
+        [[nodiscard]] constexpr auto find_slot(usize hash, const K& key) const noexcept -> usize {
+            auto slot = hash & _mask;
+            while(_slots[slot].second != npos) {
+                if(_slots[slot].first == hash && _keys[_slots[slot].second] == key) {
+                    break;
+                }
+                slot = (slot + 1) & _mask;
+            }
+            return slot;
+        }
+
+        [[nodiscard]] constexpr auto find(ProbeValueType& element) const noexcept -> usize {
+            const KeyType key = _probe_key(element);
+            return _slots[find_slot(get_hash(key), key)].second;
+        }
+
+        public:
+        KSTD_NO_COPY(JoinPipe, Self, constexpr)// Copies would reference the original's build pipe
+        KSTD_DEFAULT_MOVE(JoinPipe, Self, constexpr)
+
+        constexpr JoinPipe() noexcept :
+                _pipe {},
+                _build {},
+                _probe_key {},
+                _values {},
+                _keys {},
+                _next {},
+                _slots {},
+                _mask {0},
+                _current {},
+                _match {npos} {
+        }
+
+        constexpr JoinPipe(PipeType pipe, BuildPipeType build, ProbeKeyMapper probe_key,
+                           const BuildKeyMapper& build_key, const char* name = "join") noexcept :
+                _pipe {std::move(pipe)},
+                _build {std::move(build)},
+                _probe_key {std::move(probe_key)},
+                _values {},
+                _keys {},
+                _next {},
+                _slots {},
+                _mask {0},
+                _current {},
+                _match {npos} {
+            const tracing::Scope<> stage_scope {name, "join"};
+            profiling::StageCounters counters {};
+            {
+                profiling::StageScope<> scope {counters};
+                if constexpr(BuildPipeType::is_sized) {
+                    _values.reserve(_build.get_source_size());
+                    _keys.reserve(_build.get_source_size());
+                }
+                auto element = _build.get_next();
+                while(element) {
+                    if constexpr(std::is_lvalue_reference_v<BuildValueType>) {
+                        _values.push_back(&(*element));
+                    }
+                    else {
+                        _values.push_back(std::move(*element));
+                    }
+                    _keys.push_back(build_key(get_element(_values.size() - 1)));
+                    element = _build.get_next();
+                }
+
+                const auto size = _values.size();
+                const auto slot_count = std::bit_ceil(std::max(size << 1, min_slot_count));
+                _mask = slot_count - 1;
+                _slots.assign(slot_count, {0, npos});
+                _next.assign(size, npos);
+                // Inserting back to front leaves every chain in build order
+                for(auto index = size; index-- > 0;) {
+                    const auto hash = get_hash(_keys[index]);
+                    auto& slot = _slots[find_slot(hash, _keys[index])];
+                    _next[index] = slot.second;
+                    slot = {hash, index};
+                }
+            }
+            counters.elements_in = _values.size();
+            counters.elements_out = _values.size();
+            counters.buffer_size = _slots.capacity();
+            profiling::submit(name, counters);
+        }
+
+        ~JoinPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            if constexpr(KIND == JoinKind::INNER) {
+                while(true) {
+                    if(_match != npos) {
+                        const auto index = _match;
+                        _match = _next[index];
+                        return ValueType {*_current, get_element(index)};
+                    }
+                    _current = _pipe.get_next();
+                    if(!_current) {
+                        return {};
+                    }
+                    _match = find(*_current);
+                }
+            }
+            else {
+                auto element = _pipe.get_next();
+                while(element && ((find(*element) != npos) != (KIND == JoinKind::SEMI))) {
+                    element = _pipe.get_next();
+                }
+                return element;
+            }
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,211 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "random.hpp"
+
+namespace kstd::streams {
+    // KLL quantile sketch (Karnin, Lang, Liberty). Level h holds items of weight 2^h, full levels are sorted and
+    // every other item is promoted to the next level. The rank error is roughly 1.65 / k, memory stays O(k).
+    // Every sketch draws its own coin flips, sketches which are merged must not share a seed.
+    template<typename T>
+    struct KllSketch final {
+        // clang-format off
+        using ValueType     = T;
+        using Self          = KllSketch<ValueType>;
+        // clang-format on
+
+        static constexpr usize default_accuracy = 200;
+        static constexpr usize min_capacity = 2;
+        static constexpr f64 capacity_decay = 2.0 / 3.0;
+
+        private:
+        usize _accuracy;
+        std::vector<std::vector<ValueType>> _levels;
+        usize _size;
+        usize _max_size;
+        usize _count;
+        random::SplitMix64 _random;
+
+        [[nodiscard]] auto get_capacity(usize level) const noexcept -> usize {
+            const auto depth = static_cast<f64>(_levels.size() - level - 1);
+            const auto capacity = std::ceil(static_cast<f64>(_accuracy) * std::pow(capacity_decay, depth));
+            return std::max(min_capacity, static_cast<usize>(capacity));
+        }
+
+        auto grow() noexcept -> void {
+            _levels.emplace_back();
+            _max_size = 0;
+            for(usize level = 0; level < _levels.size(); ++level) {
+                _max_size += get_capacity(level);
+            }
+        }
+
+        [[nodiscard]] auto get_random_bit() noexcept -> usize {
+            return static_cast<usize>(_random() & 1);
+        }
+
+        auto compress() noexcept -> void {
+            for(usize level = 0; level < _levels.size(); ++level) {
+                if(_levels[level].size() < get_capacity(level)) {
+                    continue;
+                }
+                if(level + 1 >= _levels.size()) {
+                    grow();
+                }
+                auto& items = _levels[level];
+                auto& next_items = _levels[level + 1];
+                std::sort(items.begin(), items.end());
+                // Only pairs are compacted, an odd item stays on its level so no weight is lost
+                const auto pair_end = items.size() & ~usize {1};
+                for(auto index = get_random_bit(); index < pair_end; index += 2) {
+                    next_items.push_back(std::move(items[index]));
+                }
+                items.erase(items.begin(), std::next(items.begin(), static_cast<isize>(pair_end)));
+
+                _size = 0;
+                for(const auto& current_items : _levels) {
+                    _size += current_items.size();
+                }
+                if(_size < _max_size) {
+                    break;
+                }
+            }
+        }
+
+        // Retained items sorted by value, paired with their weight
+        [[nodiscard]] auto get_weighted_items() const noexcept -> std::vector<std::pair<ValueType, usize>> {
+            std::vector<std::pair<ValueType, usize>> result {};
+            result.reserve(_size);
+            for(usize level = 0; level < _levels.size(); ++level) {
+                for(const auto& item : _levels[level]) {
+                    result.emplace_back(item, usize {1} << level);
+                }
+            }
+            std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) noexcept -> bool {
+                return lhs.first < rhs.first;
+            });
+            return result;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(KllSketch, Self)
+
+        explicit KllSketch(usize accuracy = default_accuracy, u64 seed = std::random_device {}()) noexcept :
+                _accuracy {std::max(accuracy, min_capacity)},
+                _levels {},
+                _size {0},
+                _max_size {0},
+                _count {0},
+                _random {seed} {
+            grow();
+        }
+
+        ~KllSketch() noexcept = default;
+
+        auto push(ValueType value) noexcept -> void {
+            _levels.front().push_back(std::move(value));
+            ++_size;
+            ++_count;
+            if(_size >= _max_size) {
+                compress();
+            }
+        }
+
+        auto merge(const Self& other) noexcept -> void {
+            while(_levels.size() < other._levels.size()) {
+                grow();
+            }
+            for(usize level = 0; level < other._levels.size(); ++level) {
+                const auto& items = other._levels[level];
+                _levels[level].insert(_levels[level].end(), items.begin(), items.end());
+            }
+            _size += other._size;
+            _count += other._count;
+            while(_size >= _max_size) {
+                compress();
+            }
+        }
+
+        // Approximation of the item at index floor(rank * count) of the sorted input
+        [[nodiscard]] auto get_quantile(f64 rank) const noexcept -> Option<ValueType> {
+            auto quantiles = get_quantiles({rank});
+            if(quantiles.empty()) {
+                return {};
+            }
+            return std::move(quantiles.front());
+        }
+
+        // Answers all ranks with a single sort of the retained items
+        [[nodiscard]] auto get_quantiles(const std::vector<f64>& ranks) const noexcept -> std::vector<ValueType> {
+            std::vector<ValueType> result {};
+            if(_count == 0) {
+                return result;
+            }
+            result.reserve(ranks.size());
+            auto items = get_weighted_items();
+            usize total_weight = 0;
+            for(auto& item : items) {
+                total_weight += item.second;
+                item.second = total_weight;
+            }
+            for(const auto rank : ranks) {
+                const auto target = std::clamp(rank, 0.0, 1.0) * static_cast<f64>(total_weight);
+                auto iterator = std::upper_bound(items.begin(), items.end(), target,
+                                                 [](f64 weight, const auto& item) noexcept -> bool {
+                                                     return weight < static_cast<f64>(item.second);
+                                                 });
+                if(iterator == items.end()) {
+                    iterator = std::prev(items.end());
+                }
+                result.push_back(iterator->first);
+            }
+            return result;
+        }
+
+        [[nodiscard]] auto get_count() const noexcept -> usize {
+            return _count;
+        }
+
+        [[nodiscard]] auto get_retained_count() const noexcept -> usize {
+            return _size;
+        }
+
+        // Total weight of the retained items, compaction preserves it so it always equals get_count()
+        [[nodiscard]] auto get_weight() const noexcept -> usize {
+            usize result = 0;
+            for(usize level = 0; level < _levels.size(); ++level) {
+                result += _levels[level].size() << level;
+            }
+            return result;
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -34,6 +34,11 @@ namespace kstd::streams {
         static_assert(std::is_invocable_r_v<AddressType, FunctorType, AddressType>,
                       "Invalid functor signature, should be (A) -> A");
 
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = false;
+
         private:
         AddressType _current;
         FunctorType _functor;
@@ -19,9 +19,14 @@
 
 #pragma once
 
+#include <fmt/compile.h>
 #include <fmt/format.h>
 #include <kstd/non_zero.hpp>
 #include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 namespace kstd::streams::mappers {
     constexpr auto dereference = [](auto* value) noexcept -> auto& {
@@ -48,15 +53,59 @@ namespace kstd::streams::mappers {
         return value.second;
     };
 
-    template<typename... ARGS>
-    [[nodiscard]] constexpr auto format(const std::string& format, ARGS&&... args) noexcept {
-        return [&format, &args...](auto& value) -> std::string {
-            if constexpr(sizeof...(ARGS) > 0) {
-                return fmt::format(fmt::runtime(format), fmt::arg("x", value), std::forward<ARGS>(args)...);
+    template<usize INDEX>
+    constexpr auto column = [](auto row) noexcept -> auto& {
+        return row.template get<INDEX>();
+    };
+
+    // Like fmt::arg, but owns a copy of its value so it can be captured by a format mapper. Names are still referenced.
+    template<typename T>
+    struct NamedArgument final {
+        const char* name;
+        T value;
+
+        [[nodiscard]] constexpr auto get() const noexcept -> decltype(auto) {
+            return fmt::arg(name, value);
+        }
+    };
+
+    template<typename T>
+    [[nodiscard]] constexpr auto arg(const char* name, T&& value) noexcept -> NamedArgument<std::decay_t<T>> {
+        return {name, std::forward<T>(value)};
+    }
+
+    template<typename T>
+    struct FormatArgument final {
+        T value;
+
+        [[nodiscard]] constexpr auto get() const noexcept -> decltype(auto) {
+            if constexpr(requires { value.get(); }) {
+                return value.get();
             }
             else {
-                return fmt::format(fmt::runtime(format), value, std::forward<ARGS>(args)...);
+                return (value);
             }
+        }
+    };
+
+    // The element is always passed first and named x, so it can be referenced as {}, {0} or {x} with either overload.
+    // The format and the remaining arguments are captured by value, so the mapper stays valid for as long as the
+    // stream lives; pass named arguments with mappers::arg, fmt::arg only references its value.
+    template<typename... ARGS>
+    [[nodiscard]] constexpr auto format(std::string format, ARGS&&... args) noexcept {
+        return [format = std::move(format), ... args = FormatArgument<std::decay_t<ARGS>> {std::forward<ARGS>(args)}](
+                       auto& value) -> std::string {
+            return fmt::format(fmt::runtime(format), fmt::arg("x", value), args.get()...);
+        };
+    }
+
+    // Takes a format string compiled with FMT_COMPILE, which is parsed once at compile time instead of per element
+    template<typename S, typename... ARGS>
+        requires(!std::is_convertible_v<const S&, std::string>)
+    [[nodiscard]] constexpr auto format(S format, ARGS&&... args) noexcept {
+        return [format, ... args = FormatArgument<std::decay_t<ARGS>> {std::forward<ARGS>(args)}](
+                       auto& value) -> std::string {
+            return fmt::format(format, fmt::arg("x", value), args.get()...);
         };
     }
 }// namespace kstd::streams::mappers
\ No newline at end of file
@@ -0,0 +1,157 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <array>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace kstd::streams {
+    // Lazy k-way merge of pre-sorted pipes driven by a loser tree, equal elements keep the order of their pipes
+    template<typename COMPARATOR, typename PIPE, typename... PIPES>
+    struct MergePipe final {
+        // clang-format off
+        using Comparator        = COMPARATOR;
+        using Self              = MergePipe<Comparator, PIPE, PIPES...>;
+        using PipeTuple         = std::tuple<PIPE, PIPES...>;
+        using NakedValueType    = std::remove_cv_t<std::remove_reference_t<typename PIPE::ValueType>>;
+        using ValueType         = std::conditional_t<
+                                    (std::is_same_v<typename PIPE::ValueType, typename PIPES::ValueType> && ...),
+                                    typename PIPE::ValueType,
+                                    NakedValueType>;
+        // clang-format on
+
+        static_assert((std::is_same_v<NakedValueType,
+                                      std::remove_cv_t<std::remove_reference_t<typename PIPES::ValueType>>> && ...),
+                      "Merged pipes must produce the same value type");
+
+        static constexpr usize pipe_count = sizeof...(PIPES) + 1;
+        static constexpr bool is_sized = PIPE::is_sized && (PIPES::is_sized && ...);
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = PIPE::is_prefetchable && (PIPES::is_prefetchable && ...);
+
+        private:
+        PipeTuple _pipes;
+        Comparator _comparator;
+        std::array<Option<ValueType>, pipe_count> _heads;
+        // _tree[0] holds the overall winner, every inner node holds the loser of its match
+        std::array<usize, pipe_count> _tree;
+        bool _is_initialized;
+
+        template<usize... INDICES>
+        constexpr auto advance(usize index, std::index_sequence<INDICES...>) noexcept -> void {
+            ((index == INDICES ? (_heads[INDICES] = std::get<INDICES>(_pipes).get_next(), void()) : void()), ...);
+        }
+
+        template<usize... INDICES>
+        [[nodiscard]] constexpr auto get_source_size(std::index_sequence<INDICES...>) const noexcept -> usize {
+            return (std::get<INDICES>(_pipes).get_source_size() + ...);
+        }
+
+        [[nodiscard]] constexpr auto is_less(usize lhs, usize rhs) const noexcept -> bool {
+            if(!_heads[lhs]) {
+                return false;
+            }
+            if(!_heads[rhs]) {
+                return true;
+            }
+            if(_comparator(*_heads[lhs], *_heads[rhs])) {
+                return true;
+            }
+            return !_comparator(*_heads[rhs], *_heads[lhs]) && lhs < rhs;
+        }
+
+        [[nodiscard]] constexpr auto build(usize node) noexcept -> usize {
+            if(node >= pipe_count) {
+                return node - pipe_count;
+            }
+            const auto lhs = build(node << 1);
+            const auto rhs = build((node << 1) + 1);
+            if(is_less(rhs, lhs)) {
+                _tree[node] = lhs;
+                return rhs;
+            }
+            _tree[node] = rhs;
+            return lhs;
+        }
+
+        constexpr auto initialize() noexcept -> void {
+            for(usize index = 0; index < pipe_count; ++index) {
+                advance(index, std::make_index_sequence<pipe_count>());
+            }
+            _tree[0] = build(1);
+            _is_initialized = true;
+        }
+
+        constexpr auto replay(usize winner) noexcept -> void {
+            for(auto node = (winner + pipe_count) >> 1; node > 0; node >>= 1) {
+                if(is_less(_tree[node], winner)) {
+                    std::swap(_tree[node], winner);
+                }
+            }
+            _tree[0] = winner;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(MergePipe, Self, constexpr)
+
+        constexpr MergePipe() noexcept :
+                _pipes {},
+                _comparator {},
+                _heads {},
+                _tree {},
+                _is_initialized {false} {
+        }
+
+        constexpr MergePipe(Comparator comparator, PIPE pipe, PIPES... pipes) noexcept :
+                _pipes {std::move(pipe), std::move(pipes)...},
+                _comparator {std::move(comparator)},
+                _heads {},
+                _tree {},
+                _is_initialized {false} {
+        }
+
+        ~MergePipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            if(!_is_initialized) {
+                initialize();
+            }
+            const auto winner = _tree[0];
+            if(!_heads[winner]) {
+                return {};
+            }
+            auto result = std::move(_heads[winner]);
+            advance(winner, std::make_index_sequence<pipe_count>());
+            replay(winner);
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            return get_source_size(std::make_index_sequence<pipe_count>());
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,70 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <kstd/types.hpp>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace kstd::streams::parallel {
+    // Chunks smaller than this are not worth the cost of spawning a thread
+    constexpr usize min_chunk_size = 4096;
+
+    [[nodiscard]] inline auto get_thread_count(usize requested = 0) noexcept -> usize {
+        if(requested != 0) {
+            return requested;
+        }
+        return std::max<usize>(std::thread::hardware_concurrency(), 1);
+    }
+
+    [[nodiscard]] inline auto get_chunk_count(usize size, usize num_threads = 0) noexcept -> usize {
+        const auto max_chunks = std::max<usize>(size / min_chunk_size, 1);
+        return std::min(get_thread_count(num_threads), max_chunks);
+    }
+
+    [[nodiscard]] constexpr auto get_chunk(usize size, usize num_chunks, usize index) noexcept
+            -> std::pair<usize, usize> {
+        const auto chunk_size = size / num_chunks;
+        const auto remainder = size % num_chunks;
+        const auto offset = (index * chunk_size) + std::min(index, remainder);
+        return {offset, chunk_size + (index < remainder ? 1 : 0)};
+    }
+
+    // Invokes function(index) for every index in [0, num_tasks), the last task runs on the calling thread
+    template<typename F>
+    inline auto invoke(usize num_tasks, F&& function) noexcept -> void {
+        if(num_tasks == 0) {
+            return;
+        }
+        std::vector<std::thread> threads {};
+        threads.reserve(num_tasks - 1);
+        for(usize index = 0; index < num_tasks - 1; ++index) {
+            threads.emplace_back([&function, index]() noexcept -> void {
+                function(index);
+            });
+        }
+        function(num_tasks - 1);
+        for(auto& thread : threads) {
+            thread.join();
+        }
+    }
+}// namespace kstd::streams::parallel
\ No newline at end of file
@@ -25,15 +25,21 @@
 #include <type_traits>
 
 namespace kstd::streams {
-    template<typename PIPE, typename SLEEVE>
+    // Pure sleeves, like map and filter, don't observe when they run, so their elements may be pulled ahead
+    template<typename PIPE, typename SLEEVE, bool IS_PURE = false>
     struct Pipe final {
         // clang-format off
         using PipeType      = PIPE;
         using SleeveType    = SLEEVE;
-        using Self          = Pipe<PipeType, SleeveType>;
+        using Self          = Pipe<PipeType, SleeveType, IS_PURE>;
         using ValueType     = typename decltype(std::declval<SleeveType>()(std::declval<PipeType&>()))::ValueType;
         // clang-format on
 
+        static constexpr bool is_random_access = PipeType::is_random_access;
+        static constexpr bool is_sized = false;// Sleeves may drop elements
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = IS_PURE && PipeType::is_prefetchable;
+
         private:
         PipeType _pipe;
         SleeveType _sleeve;
@@ -56,5 +62,14 @@ namespace kstd::streams {
         [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
             return _sleeve(_pipe);
         }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            return _pipe.get_source_size();
+        }
+
+        [[nodiscard]] constexpr auto slice(usize offset, usize count) const noexcept -> decltype(auto) {
+            using SlicedPipe = std::remove_cv_t<decltype(_pipe.slice(offset, count))>;
+            return Pipe<SlicedPipe, SleeveType, IS_PURE> {_pipe.slice(offset, count), _sleeve};
+        }
     };
 }// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,146 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <any>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kstd::streams {
+    // A chain of stages which is defined once and applied to any number of sources. Buffered stages keep their
+    // buffer between runs, so applying the same pipeline again does not reallocate. Pipelines are not thread safe,
+    // and the streams they produce must not outlive them.
+    template<typename... STAGES>
+    struct Pipeline final {
+        // clang-format off
+        using Self          = Pipeline<STAGES...>;
+        using StageTuple    = std::tuple<STAGES...>;
+        // clang-format on
+
+        static constexpr usize stage_count = sizeof...(STAGES);
+
+        private:
+        template<typename...>
+        friend struct Pipeline;
+
+        StageTuple _stages;
+
+        template<usize INDEX, typename S>
+        [[nodiscard]] constexpr auto apply_from(S&& stream) noexcept -> decltype(auto) {
+            if constexpr(INDEX + 1 == stage_count) {
+                return std::get<INDEX>(_stages)(stream);
+            }
+            else {
+                return apply_from<INDEX + 1>(std::get<INDEX>(_stages)(stream));
+            }
+        }
+
+        // Looks up the storage for the given element type, it is only replaced when the element type changes
+        template<typename T>
+        [[nodiscard]] static auto get_storage(std::any& storage) noexcept -> std::vector<T>* {
+            auto* vector = std::any_cast<std::vector<T>>(&storage);
+            if(vector == nullptr) {
+                vector = &storage.emplace<std::vector<T>>();
+            }
+            return vector;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(Pipeline, Self, constexpr)
+
+        constexpr Pipeline() noexcept :
+                _stages {} {
+        }
+
+        explicit constexpr Pipeline(StageTuple stages) noexcept :
+                _stages {std::move(stages)} {
+        }
+
+        ~Pipeline() noexcept = default;
+
+        // Appends a stage, which is invoked with a stream lvalue and has to return the next stream
+        template<typename F>
+        [[nodiscard]] constexpr auto then(F stage) const noexcept -> Pipeline<STAGES..., F> {
+            return Pipeline<STAGES..., F> {std::tuple_cat(_stages, std::make_tuple(std::move(stage)))};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto filter(F predicate) const noexcept -> decltype(auto) {
+            return then([predicate = std::move(predicate)](auto& stream) noexcept -> decltype(auto) {
+                return stream.filter(predicate);
+            });
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto map(F mapper) const noexcept -> decltype(auto) {
+            return then([mapper = std::move(mapper)](auto& stream) noexcept -> decltype(auto) {
+                return stream.map(mapper);
+            });
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto peek(F function) const noexcept -> decltype(auto) {
+            return then([function = std::move(function)](auto& stream) noexcept -> decltype(auto) {
+                return stream.peek(function);
+            });
+        }
+
+        [[nodiscard]] auto sort() const noexcept -> decltype(auto) {
+            return then([storage = std::any {}](auto& stream) mutable noexcept -> decltype(auto) {
+                using StreamType = std::remove_reference_t<decltype(stream)>;
+                return stream.sort(get_storage<typename StreamType::NakedValueType>(storage));
+            });
+        }
+
+        [[nodiscard]] auto reverse_sort() const noexcept -> decltype(auto) {
+            return then([storage = std::any {}](auto& stream) mutable noexcept -> decltype(auto) {
+                using StreamType = std::remove_reference_t<decltype(stream)>;
+                return stream.reverse_sort(get_storage<typename StreamType::NakedValueType>(storage));
+            });
+        }
+
+        [[nodiscard]] auto distinct() const noexcept -> decltype(auto) {
+            return then([storage = std::any {}](auto& stream) mutable noexcept -> decltype(auto) {
+                using StreamType = std::remove_reference_t<decltype(stream)>;
+                return stream.distinct(get_storage<typename StreamType::NakedValueType>(storage));
+            });
+        }
+
+        template<typename S>
+        [[nodiscard]] constexpr auto apply(S&& source) noexcept -> decltype(auto) {
+            static_assert(stage_count > 0, "Pipeline has no stages");
+            return apply_from<0>(std::forward<S>(source));
+        }
+
+        template<typename S>
+        [[nodiscard]] constexpr auto operator()(S&& source) noexcept -> decltype(auto) {
+            return apply(std::forward<S>(source));
+        }
+    };
+
+    [[nodiscard]] constexpr auto pipeline() noexcept -> Pipeline<> {
+        return Pipeline<> {};
+    }
+}// namespace kstd::streams
\ No newline at end of file
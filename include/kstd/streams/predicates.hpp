@@ -0,0 +1,71 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <type_traits>
+
+namespace kstd::streams::predicates {
+    // Predicates with a known shape, find_first and index_of scan contiguous arithmetic sources for them in bulk
+    template<typename T>
+    struct EqualTo final {
+        T value;
+
+        [[nodiscard]] constexpr auto operator()(const auto& element) const noexcept -> bool {
+            return element == value;
+        }
+    };
+
+    // Both bounds are inclusive
+    template<typename T>
+    struct InRange final {
+        T min;
+        T max;
+
+        [[nodiscard]] constexpr auto operator()(const auto& element) const noexcept -> bool {
+            return min <= element && element <= max;
+        }
+    };
+
+    template<typename T>
+    [[nodiscard]] constexpr auto equal_to(T value) noexcept -> EqualTo<T> {
+        return {value};
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr auto in_range(T min, T max) noexcept -> InRange<T> {
+        return {min, max};
+    }
+
+    template<typename T>
+    constexpr bool is_equal_to = false;
+
+    template<typename T>
+    constexpr bool is_equal_to<EqualTo<T>> = true;
+
+    template<typename T>
+    constexpr bool is_in_range = false;
+
+    template<typename T>
+    constexpr bool is_in_range<InRange<T>> = true;
+
+    template<typename F>
+    constexpr bool is_scannable = is_equal_to<std::remove_cv_t<F>> || is_in_range<std::remove_cv_t<F>>;
+}// namespace kstd::streams::predicates
\ No newline at end of file
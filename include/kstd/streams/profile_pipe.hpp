@@ -0,0 +1,113 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <type_traits>
+
+#include "profiling.hpp"
+
+namespace kstd::streams {
+    template<typename PIPE>
+    struct ProfilePipe final {
+        // clang-format off
+        using PipeType      = PIPE;
+        using Self          = ProfilePipe<PipeType>;
+        using ValueType     = typename PipeType::ValueType;
+        // clang-format on
+
+        static constexpr bool is_random_access = PipeType::is_random_access;
+        static constexpr bool is_sized = PipeType::is_sized;
+        static constexpr bool is_contiguous = false;// Contiguous access would bypass the counters
+        static constexpr bool is_prefetchable = false;// Pulling ahead would move time between stages
+
+        private:
+        PipeType _pipe;
+        const char* _name;
+        profiling::StageCounters _counters;
+        usize _pulled;
+
+        public:
+        ProfilePipe() noexcept :
+                _pipe {},
+                _name {""},
+                _counters {},
+                _pulled {0} {
+        }
+
+        ProfilePipe(PipeType pipe, const char* name) noexcept :
+                _pipe {std::move(pipe)},
+                _name {name},
+                _counters {},
+                _pulled {0} {
+        }
+
+        // Copies start with fresh counters so every copy only submits what it measured itself
+        ProfilePipe(const Self& other) noexcept :
+                _pipe {other._pipe},
+                _name {other._name},
+                _counters {},
+                _pulled {0} {
+        }
+
+        ProfilePipe(Self&& other) noexcept :
+                _pipe {std::move(other._pipe)},
+                _name {other._name},
+                _counters {other._counters},
+                _pulled {other._pulled} {
+            other._counters = {};
+            other._pulled = 0;
+        }
+
+        ~ProfilePipe() noexcept {
+            // Without a profiled stage upstream, the stage starts at the source and takes in what it pulled itself
+            if(_counters.elements_in == 0) {
+                _counters.elements_in = _pulled;
+            }
+            if(_counters.elements_out != 0 || _counters.inclusive_time.count() != 0) {
+                profiling::submit<true>(_name, _counters);
+            }
+        }
+
+        auto operator=(const Self& other) noexcept -> Self& = delete;
+        auto operator=(Self&& other) noexcept -> Self& = delete;
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            profiling::StageScope<true> scope {_counters};
+            auto element = _pipe.get_next();
+            if(element) {
+                ++_pulled;
+                scope.produce();
+            }
+            return element;
+        }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            return _pipe.get_source_size();
+        }
+
+        [[nodiscard]] constexpr auto slice(usize offset, usize count) const noexcept -> decltype(auto) {
+            using SlicedPipe = std::remove_cv_t<decltype(_pipe.slice(offset, count))>;
+            return ProfilePipe<SlicedPipe> {_pipe.slice(offset, count), _name};
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,167 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <fmt/format.h>
+#include <kstd/types.hpp>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace kstd::streams::profiling {
+#ifdef KSTD_STREAMS_PROFILING
+    constexpr bool is_enabled = true;
+#else
+    constexpr bool is_enabled = false;
+#endif
+
+    using Clock = std::chrono::steady_clock;
+
+    struct StageCounters final {
+        usize elements_in;
+        usize elements_out;
+        usize buffer_size;
+        std::chrono::nanoseconds inclusive_time;
+        std::chrono::nanoseconds child_time;
+    };
+
+    struct StageReport final {
+        std::string name;
+        usize elements_in;
+        usize elements_out;
+        usize buffer_size;
+        std::chrono::nanoseconds inclusive_time;
+        std::chrono::nanoseconds exclusive_time;
+    };
+
+    // The stage currently pulling elements on this thread, used to attribute time and counts to nested stages
+    inline thread_local StageCounters* current_stage = nullptr;
+
+    // Measures nothing during constant evaluation, so profiled code stays usable in constant expressions
+    template<bool ENABLED = is_enabled>
+    class StageScope final {
+        StageCounters& _counters;
+        StageCounters* _downstream;
+        Clock::time_point _start;
+
+        public:
+        explicit constexpr StageScope(StageCounters& counters) noexcept :
+                _counters {counters},
+                _downstream {nullptr},
+                _start {} {
+            if(!std::is_constant_evaluated()) {
+                _downstream = current_stage;
+                _start = Clock::now();
+                current_stage = &_counters;
+            }
+        }
+
+        constexpr ~StageScope() noexcept {
+            if(std::is_constant_evaluated()) {
+                return;
+            }
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _start);
+            _counters.inclusive_time += elapsed;
+            current_stage = _downstream;
+            if(_downstream != nullptr) {
+                _downstream->child_time += elapsed;
+            }
+        }
+
+        constexpr auto produce() noexcept -> void {
+            ++_counters.elements_out;
+            if(_downstream != nullptr) {
+                ++_downstream->elements_in;
+            }
+        }
+    };
+
+    template<>
+    class StageScope<false> final {
+        public:
+        explicit constexpr StageScope(StageCounters&) noexcept {
+        }
+
+        constexpr auto produce() noexcept -> void {
+        }
+    };
+
+    struct Registry final {
+        std::mutex mutex;
+        std::vector<StageReport> stages;
+    };
+
+    [[nodiscard]] inline auto get_registry() noexcept -> Registry& {
+        static Registry registry {};
+        return registry;
+    }
+
+    inline auto record(const char* name, const StageCounters& counters) noexcept -> void {
+        auto& registry = get_registry();
+        const std::lock_guard lock {registry.mutex};
+        auto& stages = registry.stages;
+        auto stage = std::find_if(stages.begin(), stages.end(), [name](const auto& stage) noexcept -> bool {
+            return stage.name == name;
+        });
+        if(stage == stages.end()) {
+            stage = stages.insert(stages.end(), StageReport {name, 0, 0, 0, {}, {}});
+        }
+        stage->elements_in += counters.elements_in;
+        stage->elements_out += counters.elements_out;
+        stage->buffer_size = std::max(stage->buffer_size, counters.buffer_size);
+        stage->inclusive_time += counters.inclusive_time;
+        stage->exclusive_time += counters.inclusive_time - counters.child_time;
+    }
+
+    template<bool ENABLED = is_enabled>
+    constexpr auto submit(const char* name, const StageCounters& counters) noexcept -> void {
+        if constexpr(ENABLED) {
+            if(!std::is_constant_evaluated()) {
+                record(name, counters);
+            }
+        }
+    }
+
+    [[nodiscard]] inline auto get_report() noexcept -> std::vector<StageReport> {
+        auto& registry = get_registry();
+        const std::lock_guard lock {registry.mutex};
+        return registry.stages;
+    }
+
+    inline auto reset() noexcept -> void {
+        auto& registry = get_registry();
+        const std::lock_guard lock {registry.mutex};
+        registry.stages.clear();
+    }
+
+    [[nodiscard]] inline auto format_report() noexcept -> std::string {
+        constexpr auto row_format = "{:<32}{:>14}{:>14}{:>14}{:>18}{:>18}\n";
+        auto result = fmt::format(row_format, "stage", "in", "out", "buffer", "inclusive [us]", "exclusive [us]");
+        for(const auto& stage : get_report()) {
+            result += fmt::format(row_format, stage.name, stage.elements_in, stage.elements_out, stage.buffer_size,
+                                  stage.inclusive_time.count() / 1000, stage.exclusive_time.count() / 1000);
+        }
+        return result;
+    }
+}// namespace kstd::streams::profiling
\ No newline at end of file
@@ -0,0 +1,143 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <bit>
+#include <kstd/types.hpp>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kstd::streams::radix {
+    // Buffers smaller than this are faster to sort with std::sort
+    constexpr usize threshold = 1024;
+    constexpr usize digit_bits = 11;
+    constexpr usize digit_count = 1 << digit_bits;
+
+    template<typename T>
+    constexpr bool is_sortable = (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+                                 std::is_same_v<T, f32> || std::is_same_v<T, f64>;
+
+    // clang-format off
+    template<typename T>
+    using KeyType = std::conditional_t<std::is_floating_point_v<T>,
+                        std::conditional_t<sizeof(T) == sizeof(u32), u32, u64>,
+                        std::make_unsigned_t<std::conditional_t<std::is_floating_point_v<T>, i32, T>>>;
+    // clang-format on
+
+    // Maps a value onto an unsigned key with the same ordering
+    template<bool DESCENDING = false, typename T>
+    [[nodiscard]] constexpr auto to_key(T value) noexcept -> KeyType<T> {
+        static_assert(is_sortable<T>, "Type can't be radix sorted");
+        using Key = KeyType<T>;
+        constexpr auto sign_bit = static_cast<Key>(Key {1} << (std::numeric_limits<Key>::digits - 1));
+        Key key {};
+        if constexpr(std::is_floating_point_v<T>) {
+            const auto bits = std::bit_cast<Key>(value);
+            key = (bits & sign_bit) != 0 ? static_cast<Key>(~bits) : static_cast<Key>(bits | sign_bit);
+        }
+        else if constexpr(std::is_signed_v<T>) {
+            key = static_cast<Key>(static_cast<Key>(value) ^ sign_bit);
+        }
+        else {
+            key = value;
+        }
+        if constexpr(DESCENDING) {
+            return static_cast<Key>(~key);
+        }
+        else {
+            return key;
+        }
+    }
+
+    // Stable LSD radix sort of buffer by get_key(element), which has to return an unsigned key
+    template<typename T, typename F>
+    constexpr auto sort_by(std::vector<T>& buffer, F&& get_key) noexcept -> void {
+        using Key = std::remove_cvref_t<std::invoke_result_t<F, const T&>>;
+        static_assert(std::is_unsigned_v<Key>, "Radix keys must be unsigned");
+        constexpr usize pass_count = ((sizeof(Key) * 8) + digit_bits - 1) / digit_bits;
+
+        const auto size = buffer.size();
+        if(size < 2) {
+            return;
+        }
+
+        // One histogram per pass, kept on the heap as all of them together are too large for the stack
+        std::vector<usize> histograms(pass_count * digit_count);
+        for(const auto& element : buffer) {
+            const auto key = get_key(element);
+            for(usize pass = 0; pass < pass_count; ++pass) {
+                ++histograms[(pass * digit_count) + ((key >> (pass * digit_bits)) & (digit_count - 1))];
+            }
+        }
+
+        std::vector<T> scratch(size);
+        for(usize pass = 0; pass < pass_count; ++pass) {
+            auto* histogram = histograms.data() + (pass * digit_count);
+            const auto shift = pass * digit_bits;
+            if(histogram[(get_key(buffer[0]) >> shift) & (digit_count - 1)] == size) {
+                continue;// Every key shares this digit
+            }
+            usize offset = 0;
+            for(usize digit = 0; digit < digit_count; ++digit) {
+                const auto current = histogram[digit];
+                histogram[digit] = offset;
+                offset += current;
+            }
+            for(auto& element : buffer) {
+                scratch[histogram[(get_key(element) >> shift) & (digit_count - 1)]++] = std::move(element);
+            }
+            buffer.swap(scratch);
+        }
+    }
+
+    template<bool DESCENDING = false, typename T>
+    constexpr auto sort(std::vector<T>& buffer) noexcept -> void {
+        sort_by(buffer, [](const T& value) noexcept -> KeyType<T> {
+            return to_key<DESCENDING>(value);
+        });
+    }
+
+    // Radix sorts (key, index) pairs and then permutes the buffer, so elements are only moved once
+    template<bool DESCENDING = false, typename T, typename F>
+    constexpr auto sort_by_key(std::vector<T>& buffer, F&& key_mapper) noexcept -> void {
+        using Value = std::remove_cvref_t<std::invoke_result_t<F, T&>>;
+        using Key = KeyType<Value>;
+        using Entry = std::pair<Key, usize>;
+
+        const auto size = buffer.size();
+        std::vector<Entry> entries(size);
+        for(usize index = 0; index < size; ++index) {
+            entries[index] = {to_key<DESCENDING>(key_mapper(buffer[index])), index};
+        }
+        sort_by(entries, [](const Entry& entry) noexcept -> Key {
+            return entry.first;
+        });
+
+        std::vector<T> result {};
+        result.reserve(size);
+        for(const auto& entry : entries) {
+            result.push_back(std::move(buffer[entry.second]));
+        }
+        buffer = std::move(result);
+    }
+}// namespace kstd::streams::radix
\ No newline at end of file
@@ -0,0 +1,66 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <cmath>
+#include <kstd/types.hpp>
+#include <limits>
+
+namespace kstd::streams::random {
+    // SplitMix64, small enough to live inside a pipe and usable with <random> distributions
+    struct SplitMix64 final {
+        using result_type = u64;
+
+        u64 state;
+
+        [[nodiscard]] static constexpr auto min() noexcept -> result_type {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        [[nodiscard]] static constexpr auto max() noexcept -> result_type {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        constexpr auto operator()() noexcept -> result_type {
+            state += 0x9E3779B97F4A7C15ULL;
+            auto value = state;
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+            return value ^ (value >> 31);
+        }
+    };
+
+    // Uniform value in (0, 1], never zero so it is always safe to take the logarithm
+    template<typename G>
+    [[nodiscard]] constexpr auto get_uniform(G& generator) noexcept -> f64 {
+        return static_cast<f64>((generator() >> 11) + 1) * 0x1.0p-53;
+    }
+
+    // Number of failures before the first success of a Bernoulli(probability) process
+    template<typename G>
+    [[nodiscard]] auto get_geometric(G& generator, f64 probability) noexcept -> usize {
+        const auto skip = std::floor(std::log(get_uniform(generator)) / std::log1p(-probability));
+        if(skip >= static_cast<f64>(std::numeric_limits<usize>::max())) {
+            return std::numeric_limits<usize>::max();
+        }
+        return static_cast<usize>(skip);
+    }
+}// namespace kstd::streams::random
\ No newline at end of file
@@ -0,0 +1,92 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+#include <utility>
+
+#include "zip_pipe.hpp"
+
+namespace kstd::streams {
+    // Yields (key, run length) for every run of adjacent elements which map to the same key
+    template<typename PIPE, typename KEY_MAPPER>
+    struct RunPipe final {
+        // clang-format off
+        using PipeType      = PIPE;
+        using KeyMapper     = KEY_MAPPER;
+        using Self          = RunPipe<PipeType, KeyMapper>;
+        using KeyType       = std::remove_cv_t<std::remove_reference_t<
+                                std::invoke_result_t<const KeyMapper&, typename PipeType::ValueType&>>>;
+        using ValueType     = Zipped<KeyType, usize>;
+        // clang-format on
+
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = PipeType::is_prefetchable;
+
+        private:
+        PipeType _pipe;
+        KeyMapper _key_mapper;
+        Option<typename PipeType::ValueType> _head;
+        bool _is_initialized;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(RunPipe, Self, constexpr)
+
+        constexpr RunPipe() noexcept :
+                _pipe {},
+                _key_mapper {},
+                _head {},
+                _is_initialized {false} {
+        }
+
+        constexpr RunPipe(PipeType pipe, KeyMapper key_mapper) noexcept :
+                _pipe {std::move(pipe)},
+                _key_mapper {std::move(key_mapper)},
+                _head {},
+                _is_initialized {false} {
+        }
+
+        ~RunPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            if(!_is_initialized) {
+                _head = _pipe.get_next();
+                _is_initialized = true;
+            }
+            if(!_head) {
+                return {};
+            }
+            KeyType key = _key_mapper(*_head);
+            usize length = 1;
+            _head = _pipe.get_next();
+            while(_head && _key_mapper(*_head) == key) {
+                ++length;
+                _head = _pipe.get_next();
+            }
+            return ValueType {std::move(key), length};
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
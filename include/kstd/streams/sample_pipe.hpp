@@ -0,0 +1,99 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+#include <utility>
+
+#include "random.hpp"
+
+namespace kstd::streams {
+    // Bernoulli sampling, draws the length of the gap to the next sampled element instead of a coin per element
+    template<typename PIPE>
+    struct SamplePipe final {
+        // clang-format off
+        using PipeType  = PIPE;
+        using Self      = SamplePipe<PipeType>;
+        using ValueType = typename PipeType::ValueType;
+        // clang-format on
+
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = PipeType::is_prefetchable;
+
+        private:
+        PipeType _pipe;
+        f64 _probability;
+        random::SplitMix64 _random;
+
+        template<typename P>
+        static constexpr bool can_skip = P::is_random_access && std::is_same_v<
+                std::remove_cv_t<decltype(std::declval<const P&>().slice(0, 0))>, P>;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(SamplePipe, Self, constexpr)
+
+        constexpr SamplePipe() noexcept :
+                _pipe {},
+                _probability {0.0},
+                _random {} {
+        }
+
+        constexpr SamplePipe(PipeType pipe, f64 probability, u64 seed) noexcept :
+                _pipe {std::move(pipe)},
+                _probability {probability},
+                _random {seed} {
+        }
+
+        ~SamplePipe() noexcept = default;
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            if(_probability <= 0.0) {
+                return {};
+            }
+            if(_probability >= 1.0) {
+                return _pipe.get_next();
+            }
+            auto skip = random::get_geometric(_random, _probability);
+            if constexpr(can_skip<PipeType>) {
+                const auto size = _pipe.get_source_size();
+                if(skip >= size) {
+                    _pipe = _pipe.slice(size, 0);
+                    return {};
+                }
+                _pipe = _pipe.slice(skip, size - skip);
+            }
+            else {
+                while(skip > 0) {
+                    if(!_pipe.get_next()) {
+                        return {};
+                    }
+                    --skip;
+                }
+            }
+            return _pipe.get_next();
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
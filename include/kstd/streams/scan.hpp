@@ -0,0 +1,134 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <cstring>
+#include <kstd/types.hpp>
+#include <limits>
+#include <type_traits>
+
+#include "predicates.hpp"
+
+namespace kstd::streams::scan {
+    // Elements are tested a block at a time without branching so the compiler can vectorize the comparisons,
+    // only the block containing the first match is searched element by element
+    constexpr usize block_size = 64;
+
+    template<typename T, typename F>
+    [[nodiscard]] constexpr auto find_block(const T* data, usize size, const F& matches) noexcept -> usize {
+        usize offset = 0;
+        for(; offset + block_size <= size; offset += block_size) {
+            u8 any_match = 0;
+            for(usize index = 0; index < block_size; ++index) {
+                any_match |= static_cast<u8>(matches(data[offset + index]));
+            }
+            if(any_match != 0) {
+                break;
+            }
+        }
+        for(; offset < size; ++offset) {
+            if(matches(data[offset])) {
+                return offset;
+            }
+        }
+        return size;
+    }
+
+    // Whether value can be converted to T without undefined behaviour, NaN and out of range floating-point values
+    // can't. Integral conversions are always defined.
+    template<typename T, typename V>
+    [[nodiscard]] constexpr auto is_representable(V value) noexcept -> bool {
+        if constexpr(std::is_floating_point_v<V> && std::is_integral_v<T>) {
+            // max() + 1 is a power of two and therefore exact, unlike max() itself. NaN fails both comparisons.
+            constexpr auto upper = static_cast<V>((std::numeric_limits<T>::max() / 2) + 1) * V {2};
+            return value >= static_cast<V>(std::numeric_limits<T>::lowest()) && value < upper;
+        }
+        else if constexpr(std::is_floating_point_v<V> && std::is_floating_point_v<T> && sizeof(V) > sizeof(T)) {
+            constexpr auto max = static_cast<V>(std::numeric_limits<T>::max());
+            constexpr auto infinity = std::numeric_limits<V>::infinity();
+            return (value >= -max && value <= max) || value == infinity || value == -infinity;
+        }
+        else {
+            return true;
+        }
+    }
+
+    // Returns the index of the first element equal to value, or size if there is none
+    template<typename T, typename V>
+    [[nodiscard]] constexpr auto find_equal(const T* data, usize size, V value) noexcept -> usize {
+        static_assert(std::is_arithmetic_v<T>, "Scanning requires an arithmetic element type");
+        if(!is_representable<T>(value)) {
+            return size;// No element can be equal to a value outside of the element type's range
+        }
+        const auto needle = static_cast<T>(value);
+        if(static_cast<V>(needle) != value) {
+            return size;// The value is not representable by the element type
+        }
+        if constexpr(std::is_integral_v<T> && sizeof(T) == 1) {
+            if(!std::is_constant_evaluated()) {
+                const auto* match = std::memchr(data, static_cast<unsigned char>(needle), size);
+                return match == nullptr ? size : static_cast<usize>(static_cast<const T*>(match) - data);
+            }
+        }
+        return find_block(data, size, [needle](T element) noexcept -> bool {
+            return element == needle;
+        });
+    }
+
+    // Returns the index of the first element within [min, max], or size if there is none. Elements and bounds are
+    // compared in their common type like the predicate would, so fractional or out of range bounds are kept intact
+    template<typename T, typename V>
+    [[nodiscard]] constexpr auto find_in_range(const T* data, usize size, V min, V max) noexcept -> usize {
+        static_assert(std::is_arithmetic_v<T>, "Scanning requires an arithmetic element type");
+        using CommonType = std::common_type_t<T, V>;
+        const auto lower = static_cast<CommonType>(min);
+        const auto upper = static_cast<CommonType>(max);
+        if constexpr(std::is_integral_v<CommonType>) {
+            // A single unsigned comparison per element
+            using UnsignedType = std::make_unsigned_t<CommonType>;
+            if(upper < lower) {
+                return size;
+            }
+            const auto width = static_cast<UnsignedType>(static_cast<UnsignedType>(upper) -
+                                                         static_cast<UnsignedType>(lower));
+            return find_block(data, size, [lower, width](T element) noexcept -> bool {
+                return static_cast<UnsignedType>(static_cast<UnsignedType>(static_cast<CommonType>(element)) -
+                                                 static_cast<UnsignedType>(lower)) <= width;
+            });
+        }
+        else {
+            return find_block(data, size, [lower, upper](T element) noexcept -> bool {
+                const auto value = static_cast<CommonType>(element);
+                return lower <= value && value <= upper;
+            });
+        }
+    }
+
+    template<typename T, typename F>
+    [[nodiscard]] constexpr auto find(const T* data, usize size, const F& predicate) noexcept -> usize {
+        if constexpr(predicates::is_equal_to<F>) {
+            return find_equal(data, size, predicate.value);
+        }
+        else {
+            return find_in_range(data, size, predicate.min, predicate.max);
+        }
+    }
+}// namespace kstd::streams::scan
\ No newline at end of file
@@ -0,0 +1,141 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <type_traits>
+
+namespace kstd::streams {
+    // Filters a contiguous source block by block into a selection vector, without branching on the predicate
+    template<typename PIPE, typename PREDICATE>
+    struct SelectionPipe final {
+        // clang-format off
+        using PipeType      = PIPE;
+        using PredicateType = PREDICATE;
+        using Self          = SelectionPipe<PipeType, PredicateType>;
+        using ValueType     = typename PipeType::ValueType;
+        using ElementType   = typename PipeType::ElementType;
+        // clang-format on
+
+        static constexpr usize block_size = 256;
+        static constexpr usize mask_size = 64;
+        static constexpr bool is_random_access = PipeType::is_random_access;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = PipeType::is_prefetchable;
+
+        static_assert(PipeType::is_contiguous, "Selection pipe requires a contiguous source");
+
+        private:
+        PipeType _pipe;
+        PredicateType _predicate;
+        usize _offset;
+        usize _block_offset;
+        usize _selection_size;
+        usize _selection_index;
+        std::array<u8, block_size> _selection;
+
+        [[nodiscard]] constexpr auto select_next_block() noexcept -> bool {
+            const auto size = _pipe.get_source_size();
+            const auto* data = _pipe.get_data();
+            while(_offset < size) {
+                const auto count = std::min(block_size, size - _offset);
+                const auto* block = data + _offset;
+                usize selected = 0;
+                for(usize index = 0; index < count; ++index) {
+                    _selection[selected] = static_cast<u8>(index);
+                    selected += static_cast<usize>(static_cast<bool>(_predicate(block[index])));
+                }
+                _block_offset = _offset;
+                _offset += count;
+                _selection_size = selected;
+                _selection_index = 0;
+                if(selected != 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(SelectionPipe, Self, constexpr)
+
+        constexpr SelectionPipe() noexcept :
+                _pipe {},
+                _predicate {},
+                _offset {0},
+                _block_offset {0},
+                _selection_size {0},
+                _selection_index {0},
+                _selection {} {
+        }
+
+        constexpr SelectionPipe(PipeType pipe, PredicateType predicate) noexcept :
+                _pipe {std::move(pipe)},
+                _predicate {std::move(predicate)},
+                _offset {0},
+                _block_offset {0},
+                _selection_size {0},
+                _selection_index {0},
+                _selection {} {
+        }
+
+        ~SelectionPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            if(_selection_index == _selection_size && !select_next_block()) {
+                return {};
+            }
+            return _pipe.get_data()[_block_offset + _selection[_selection_index++]];
+        }
+
+        // Counts the remaining elements by building predicate bitmasks and summing their popcounts
+        [[nodiscard]] constexpr auto get_remaining_count() noexcept -> usize {
+            auto result = _selection_size - _selection_index;
+            const auto size = _pipe.get_source_size();
+            const auto* data = _pipe.get_data();
+            for(; _offset < size; _offset += mask_size) {
+                const auto count = std::min(mask_size, size - _offset);
+                u64 mask = 0;
+                for(usize index = 0; index < count; ++index) {
+                    mask |= static_cast<u64>(static_cast<bool>(_predicate(data[_offset + index]))) << index;
+                }
+                result += static_cast<usize>(std::popcount(mask));
+            }
+            _offset = size;
+            _selection_index = _selection_size;
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            return _pipe.get_source_size();
+        }
+
+        [[nodiscard]] constexpr auto slice(usize offset, usize count) const noexcept -> decltype(auto) {
+            using SlicedPipe = std::remove_cv_t<decltype(_pipe.slice(offset, count))>;
+            return SelectionPipe<SlicedPipe, PredicateType> {_pipe.slice(offset, count), _predicate};
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
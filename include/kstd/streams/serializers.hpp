@@ -0,0 +1,50 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <cstdio>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+
+namespace kstd::streams::serializers {
+    struct Trivial final {
+        template<typename T>
+        auto write(std::FILE* file, const T* values, usize count) const noexcept -> bool {
+            static_assert(std::is_trivially_copyable_v<T>, "Type is not trivially copyable, use a custom serializer");
+            return std::fwrite(values, sizeof(T), count, file) == count;
+        }
+
+        // Returns the number of values read, which is only less than count at the end of the file, or an empty
+        // option if the values could not be read
+        template<typename T>
+        auto read(std::FILE* file, T* values, usize count) const noexcept -> Option<usize> {
+            static_assert(std::is_trivially_copyable_v<T>, "Type is not trivially copyable, use a custom serializer");
+            const auto read_count = std::fread(values, sizeof(T), count, file);
+            if(read_count < count && std::ferror(file) != 0) {
+                return {};
+            }
+            return read_count;
+        }
+    };
+
+    constexpr Trivial trivial {};
+}// namespace kstd::streams::serializers
\ No newline at end of file
@@ -0,0 +1,204 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace kstd::streams {
+    enum class SetOperation : u8 {
+        INTERSECTION,
+        UNION,
+        DIFFERENCE
+    };
+
+    // Single merge-style pass over two sorted pipes with multiset semantics like std::set_intersection and friends.
+    // Contiguous pipes are skipped over with a galloping search instead of being pulled element by element.
+    template<typename LHS, typename RHS, typename COMPARATOR, SetOperation OPERATION>
+    struct SetOperationPipe final {
+        // clang-format off
+        using LhsPipeType       = LHS;
+        using RhsPipeType       = RHS;
+        using Comparator        = COMPARATOR;
+        using Self              = SetOperationPipe<LhsPipeType, RhsPipeType, Comparator, OPERATION>;
+        using NakedValueType    = std::remove_cv_t<std::remove_reference_t<typename LhsPipeType::ValueType>>;
+        using ValueType         = std::conditional_t<
+                                    std::is_same_v<typename LhsPipeType::ValueType, typename RhsPipeType::ValueType>,
+                                    typename LhsPipeType::ValueType,
+                                    NakedValueType>;
+        // clang-format on
+
+        static_assert(std::is_same_v<NakedValueType,
+                                     std::remove_cv_t<std::remove_reference_t<typename RhsPipeType::ValueType>>>,
+                      "Both pipes must produce the same value type");
+
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = LhsPipeType::is_prefetchable && RhsPipeType::is_prefetchable;
+
+        private:
+        LhsPipeType _lhs_pipe;
+        RhsPipeType _rhs_pipe;
+        Comparator _comparator;
+        Option<typename LhsPipeType::ValueType> _lhs;
+        Option<typename RhsPipeType::ValueType> _rhs;
+        bool _is_initialized;
+
+        template<typename P>
+        static constexpr bool can_gallop = P::is_contiguous && std::is_same_v<
+                std::remove_cv_t<decltype(std::declval<const P&>().slice(0, 0))>, P>;
+
+        // Advances the given pipe until its head is no longer less than target
+        template<typename P, typename H>
+        constexpr auto skip_less(P& pipe, H& head, const NakedValueType& target) noexcept -> void {
+            if constexpr(can_gallop<P>) {
+                if(!head || !_comparator(*head, target)) {
+                    return;
+                }
+                const auto* data = pipe.get_data();
+                const auto size = pipe.get_source_size();
+                usize bound = 1;
+                while(bound <= size && _comparator(data[bound - 1], target)) {
+                    bound <<= 1;
+                }
+                const auto* begin = data + (bound >> 1);
+                const auto* end = data + std::min(bound, size);
+                const auto offset = static_cast<usize>(std::lower_bound(begin, end, target, _comparator) - data);
+                pipe = pipe.slice(offset, size - offset);
+                head = pipe.get_next();
+            }
+            else {
+                while(head && _comparator(*head, target)) {
+                    head = pipe.get_next();
+                }
+            }
+        }
+
+        // Only heads owned by the pipe are moved from, referenced elements belong to the caller and are copied
+        template<typename T>
+        [[nodiscard]] static constexpr auto take(Option<T>& head) noexcept -> ValueType {
+            if constexpr(std::is_lvalue_reference_v<T>) {
+                return *head;
+            }
+            else {
+                return std::move(*head);
+            }
+        }
+
+        constexpr auto advance_lhs() noexcept -> void {
+            _lhs = _lhs_pipe.get_next();
+        }
+
+        constexpr auto advance_rhs() noexcept -> void {
+            _rhs = _rhs_pipe.get_next();
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(SetOperationPipe, Self, constexpr)
+
+        constexpr SetOperationPipe() noexcept :
+                _lhs_pipe {},
+                _rhs_pipe {},
+                _comparator {},
+                _lhs {},
+                _rhs {},
+                _is_initialized {false} {
+        }
+
+        constexpr SetOperationPipe(LhsPipeType lhs, RhsPipeType rhs, Comparator comparator) noexcept :
+                _lhs_pipe {std::move(lhs)},
+                _rhs_pipe {std::move(rhs)},
+                _comparator {std::move(comparator)},
+                _lhs {},
+                _rhs {},
+                _is_initialized {false} {
+        }
+
+        ~SetOperationPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            if(!_is_initialized) {
+                advance_lhs();
+                advance_rhs();
+                _is_initialized = true;
+            }
+
+            if constexpr(OPERATION == SetOperation::INTERSECTION) {
+                while(_lhs && _rhs) {
+                    if(_comparator(*_lhs, *_rhs)) {
+                        skip_less(_lhs_pipe, _lhs, *_rhs);
+                    }
+                    else if(_comparator(*_rhs, *_lhs)) {
+                        skip_less(_rhs_pipe, _rhs, *_lhs);
+                    }
+                    else {
+                        ValueType result = take(_lhs);
+                        advance_lhs();
+                        advance_rhs();
+                        return result;
+                    }
+                }
+                return {};
+            }
+            else if constexpr(OPERATION == SetOperation::UNION) {
+                if(!_lhs && !_rhs) {
+                    return {};
+                }
+                if(!_rhs || (_lhs && _comparator(*_lhs, *_rhs))) {
+                    ValueType result = take(_lhs);
+                    advance_lhs();
+                    return result;
+                }
+                if(!_lhs || _comparator(*_rhs, *_lhs)) {
+                    ValueType result = take(_rhs);
+                    advance_rhs();
+                    return result;
+                }
+                ValueType result = take(_lhs);
+                advance_lhs();
+                advance_rhs();
+                return result;
+            }
+            else {
+                while(_lhs) {
+                    if(!_rhs || _comparator(*_lhs, *_rhs)) {
+                        ValueType result = take(_lhs);
+                        advance_lhs();
+                        return result;
+                    }
+                    if(_comparator(*_rhs, *_lhs)) {
+                        skip_less(_rhs_pipe, _rhs, *_lhs);
+                    }
+                    else {
+                        advance_lhs();
+                        advance_rhs();
+                    }
+                }
+                return {};
+            }
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -20,22 +20,55 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
 #include <kstd/pack.hpp>
+#include <random>
+#include <ranges>
+#include <type_traits>
 #include <unordered_set>
+#include <vector>
 
+#include "any_pipe.hpp"
+#include "bloom_filter.hpp"
 #include "buffered_pipe.hpp"
+#include "column_pipe.hpp"
+#include "distinct_sorted_pipe.hpp"
+#include "enumerate_pipe.hpp"
+#include "external_sort_pipe.hpp"
 #include "iterator_pipe.hpp"
+#include "join_pipe.hpp"
 #include "linked_struct_pipe.hpp"
+#include "merge_pipe.hpp"
+#include "parallel.hpp"
 #include "pipe.hpp"
+#include "pipeline.hpp"
+#include "profile_pipe.hpp"
+#include "radix_sort.hpp"
+#include "run_pipe.hpp"
+#include "sample_pipe.hpp"
+#include "selection_pipe.hpp"
+#include "set_operation_pipe.hpp"
 #include "supplier_pipe.hpp"
+#include "window_pipe.hpp"
+#include "zip_pipe.hpp"
 
 #include "collectors.hpp"
 #include "comparators.hpp"
 #include "filters.hpp"
+#include "hyper_log_log.hpp"
+#include "kll_sketch.hpp"
 #include "mappers.hpp"
+#include "predicates.hpp"
+#include "profiling.hpp"
+#include "random.hpp"
 #include "reducers.hpp"
+#include "scan.hpp"
+#include "serializers.hpp"
+#include "summary.hpp"
+#include "tracing.hpp"
 
 #define KSTD_PTR_FIELD_FUNCTOR(n)                                                                                      \
     [](auto* value) noexcept -> auto {                                                                                 \
@@ -83,11 +116,24 @@ namespace kstd::streams {
         // clang-format on
 
         private:
+        template<typename>
+        friend struct Stream;
+
         PipeType _pipe;
 
+        // Recognized predicates on contiguous arithmetic sources are answered by the scan kernels
+        template<typename F>
+        static constexpr bool is_scannable = PipeType::is_contiguous && std::is_arithmetic_v<NakedValueType> &&
+                                             predicates::is_scannable<F>;
+
+        // The selection vector evaluates the predicate a block ahead, which is only unobservable for pure predicates
+        template<typename F>
+        static constexpr bool is_selectable = PipeType::is_contiguous && std::is_arithmetic_v<NakedValueType> &&
+                                              (filters::is_pure<F> || predicates::is_scannable<F>);
+
         template<typename F>
         [[nodiscard]] constexpr auto make_filter_sleeve(F predicate) noexcept -> decltype(auto) {
-            return [predicate = std::move(predicate)](PipeType& pipe) noexcept -> Option<ValueType> {
+            return [predicate = std::move(predicate)](auto& pipe) noexcept -> Option<ValueType> {
                 auto element = pipe.get_next();
                 while(element && !predicate(*element)) {
                     element = pipe.get_next();
@@ -96,9 +142,12 @@ namespace kstd::streams {
             };
         }
 
+        template<typename F>
+        using MapResult = std::invoke_result_t<F, ValueType>;
+
         template<typename F>
         [[nodiscard]] constexpr auto make_map_sleeve(F mapper) noexcept -> decltype(auto) {
-            return [mapper = std::move(mapper)](PipeType& pipe) noexcept -> Option<std::invoke_result_t<F, ValueType>> {
+            return [mapper = std::move(mapper)](auto& pipe) noexcept -> Option<MapResult<F>> {
                 auto element = pipe.get_next();
                 if(!element) {
                     return {};
@@ -109,7 +158,7 @@ namespace kstd::streams {
 
         template<typename F>
         [[nodiscard]] constexpr auto make_peek_sleeve(F function) noexcept -> decltype(auto) {
-            return [function = std::move(function)](PipeType& pipe) noexcept -> Option<ValueType> {
+            return [function = std::move(function)](auto& pipe) noexcept -> Option<ValueType> {
                 auto element = pipe.get_next();
                 if(!element) {
                     return {};
@@ -121,6 +170,13 @@ namespace kstd::streams {
 
         [[nodiscard]] constexpr auto make_sort_callback() noexcept -> decltype(auto) {
             return [](auto& buffer) noexcept -> void {
+                using Type = typename std::remove_reference_t<decltype(buffer)>::value_type;
+                if constexpr(radix::is_sortable<Type>) {
+                    if(buffer.size() >= radix::threshold) {
+                        radix::sort(buffer);
+                        return;
+                    }
+                }
                 std::sort(buffer.begin(), buffer.end());
             };
         }
@@ -134,10 +190,58 @@ namespace kstd::streams {
 
         [[nodiscard]] constexpr auto make_reverse_sort_callback() noexcept -> decltype(auto) {
             return [](auto& buffer) noexcept -> void {
+                using Type = typename std::remove_reference_t<decltype(buffer)>::value_type;
+                if constexpr(radix::is_sortable<Type>) {
+                    if(buffer.size() >= radix::threshold) {
+                        radix::sort<true>(buffer);
+                        return;
+                    }
+                }
                 std::sort(buffer.rbegin(), buffer.rend());
             };
         }
 
+        // Decorate-sort-undecorate: every key is computed once into a compact (key, index) array
+        template<bool DESCENDING, typename F>
+        [[nodiscard]] constexpr auto make_sort_by_callback(F key_mapper) noexcept -> decltype(auto) {
+            return [key_mapper = std::move(key_mapper)](auto& buffer) noexcept -> void {
+                using Buffer = std::remove_reference_t<decltype(buffer)>;
+                using Key = std::remove_cvref_t<std::invoke_result_t<const F&, typename Buffer::value_type&>>;
+                if constexpr(radix::is_sortable<Key>) {
+                    if(buffer.size() >= radix::threshold) {
+                        radix::sort_by_key<DESCENDING>(buffer, key_mapper);
+                        return;
+                    }
+                }
+
+                const auto size = buffer.size();
+                std::vector<std::pair<Key, usize>> entries {};
+                entries.reserve(size);
+                for(usize index = 0; index < size; ++index) {
+                    entries.emplace_back(key_mapper(buffer[index]), index);
+                }
+                std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) noexcept -> bool {
+                    const auto is_less = DESCENDING ? rhs.first < lhs.first : lhs.first < rhs.first;
+                    const auto is_greater = DESCENDING ? lhs.first < rhs.first : rhs.first < lhs.first;
+                    return is_less || (!is_greater && lhs.second < rhs.second);
+                });
+
+                Buffer result {};
+                result.reserve(size);
+                for(const auto& entry : entries) {
+                    result.push_back(std::move(buffer[entry.second]));
+                }
+                buffer = std::move(result);
+            };
+        }
+
+        template<bool DESCENDING, typename F>
+        [[nodiscard]] constexpr auto make_sort_by_key_callback(F key_mapper) noexcept -> decltype(auto) {
+            return [key_mapper = std::move(key_mapper)](auto& buffer) noexcept -> void {
+                radix::sort_by_key<DESCENDING>(buffer, key_mapper);
+            };
+        }
+
         template<typename F>
         [[nodiscard]] constexpr auto make_reverse_sort_callback(F comparator) noexcept -> decltype(auto) {// NOLINT
             return [comparator = std::move(comparator)](auto& buffer) noexcept -> void {
@@ -147,13 +251,69 @@ namespace kstd::streams {
 
         [[nodiscard]] constexpr auto make_distinct_callback() noexcept -> decltype(auto) {
             return [](auto& buffer) noexcept -> void {
-                using Buffer = std::remove_reference_t<decltype(buffer)>;
-                using Type = std::decay_t<typename Buffer::value_type>;
-                const std::unordered_set<Type> elements {buffer.cbegin(), buffer.cend()};
-                buffer = {elements.cbegin(), elements.cend()};
+                if(std::is_constant_evaluated()) {
+                    distinct_constant(buffer);
+                }
+                else {
+                    distinct_hashed(buffer);
+                }
             };
         }
 
+        // Keeps the first occurrence of every element in encounter order
+        template<typename BUFFER>
+        static auto distinct_hashed(BUFFER& buffer) noexcept -> void {
+            using Type = std::decay_t<typename BUFFER::value_type>;
+            std::unordered_set<Type> elements {};
+            elements.reserve(buffer.size());
+            usize size = 0;
+            for(usize index = 0; index < buffer.size(); ++index) {
+                if(!elements.insert(buffer[index]).second) {
+                    continue;
+                }
+                if(size != index) {
+                    buffer[size] = std::move(buffer[index]);
+                }
+                ++size;
+            }
+            buffer.erase(std::next(buffer.begin(), static_cast<isize>(size)), buffer.end());
+        }
+
+        // std::unordered_set can't be used during constant evaluation, so find the first occurrence of every
+        // element by sorting indices instead, falling back to a linear search for types without operator<
+        template<typename BUFFER>
+        static constexpr auto distinct_constant(BUFFER& buffer) noexcept -> void {
+            using Type = std::decay_t<typename BUFFER::value_type>;
+            BUFFER result {};
+            if constexpr(requires(const Type& lhs, const Type& rhs) { lhs < rhs; }) {
+                const auto size = buffer.size();
+                std::vector<usize> indices(size);
+                for(usize index = 0; index < size; ++index) {
+                    indices[index] = index;
+                }
+                std::sort(indices.begin(), indices.end(), [&buffer](usize lhs, usize rhs) noexcept -> bool {
+                    return buffer[lhs] < buffer[rhs] || (!(buffer[rhs] < buffer[lhs]) && lhs < rhs);
+                });
+                std::vector<u8> is_first(size);
+                for(usize index = 0; index < size; ++index) {
+                    is_first[indices[index]] = index == 0 || buffer[indices[index - 1]] < buffer[indices[index]];
+                }
+                for(usize index = 0; index < size; ++index) {
+                    if(is_first[index] != 0) {
+                        result.push_back(std::move(buffer[index]));
+                    }
+                }
+            }
+            else {
+                for(auto& element : buffer) {
+                    if(std::find(result.cbegin(), result.cend(), element) == result.cend()) {
+                        result.push_back(std::move(element));
+                    }
+                }
+            }
+            buffer = std::move(result);
+        }
+
         public:
         KSTD_NO_MOVE_COPY(Stream, Self, constexpr)// Streams are temporary only
 
@@ -163,11 +323,11 @@ namespace kstd::streams {
 
         ~Stream() noexcept = default;
 
+        // Mapped elements may be pulled ahead when they are owned, references may point into the upstream element
         template<typename F>
-        [[nodiscard]] constexpr auto map(F mapper) noexcept
-                -> Stream<Pipe<PipeType, decltype(make_map_sleeve(std::move(mapper)))>> {
+        [[nodiscard]] constexpr auto map(F mapper) noexcept -> decltype(auto) {
             auto sleeve = make_map_sleeve(std::move(mapper));
-            using Pipe = Pipe<PipeType, decltype(sleeve)>;
+            using Pipe = Pipe<PipeType, decltype(sleeve), !std::is_reference_v<MapResult<F>>>;
             return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
         }
 
@@ -180,13 +340,52 @@ namespace kstd::streams {
         }
 
         template<typename F>
-        [[nodiscard]] constexpr auto filter(F predicate) noexcept
-                -> Stream<Pipe<PipeType, decltype(make_filter_sleeve(std::move(predicate)))>> {
+        [[nodiscard]] constexpr auto filter(F predicate) noexcept -> decltype(auto) {
             static_assert(std::is_convertible_v<F, std::function<bool(ValueType)>>,
                           "Predicate signature does not match");
-            auto sleeve = make_filter_sleeve(std::move(predicate));
-            using Pipe = Pipe<PipeType, decltype(sleeve)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
+            if constexpr(is_selectable<F>) {
+                using Pipe = SelectionPipe<PipeType, F>;
+                return Stream<Pipe> {Pipe {std::move(_pipe), std::move(predicate)}};
+            }
+            else {
+                auto sleeve = make_filter_sleeve(std::move(predicate));
+                using Pipe = Pipe<PipeType, decltype(sleeve), true>;
+                return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
+            }
+        }
+
+        // The Bloom filter is referenced and has to outlive the stream. Positives may optionally be confirmed by an
+        // exact check, which is only invoked for elements the filter could not reject.
+        template<typename T>
+        [[nodiscard]] auto filter_in(const BloomFilter<T>& bloom_filter) noexcept -> decltype(auto) {
+            return filter([&bloom_filter](const auto& value) noexcept -> bool {
+                return bloom_filter.contains(value);
+            });
+        }
+
+        template<typename T, typename F>
+        [[nodiscard]] auto filter_in(const BloomFilter<T>& bloom_filter, F exact_check) noexcept -> decltype(auto) {
+            auto predicate = [&bloom_filter, exact_check = std::move(exact_check)](const auto& value) noexcept -> bool {
+                return bloom_filter.contains(value) && exact_check(value);
+            };
+            return filter(std::move(predicate));
+        }
+
+        // Without an exact check, a false positive rate's worth of elements outside of the set is dropped as well
+        template<typename T>
+        [[nodiscard]] auto filter_not_in(const BloomFilter<T>& bloom_filter) noexcept -> decltype(auto) {
+            return filter([&bloom_filter](const auto& value) noexcept -> bool {
+                return !bloom_filter.contains(value);
+            });
+        }
+
+        template<typename T, typename F>
+        [[nodiscard]] auto filter_not_in(const BloomFilter<T>& bloom_filter, F exact_check) noexcept
+                -> decltype(auto) {
+            auto predicate = [&bloom_filter, exact_check = std::move(exact_check)](const auto& value) noexcept -> bool {
+                return !bloom_filter.contains(value) || !exact_check(value);
+            };
+            return filter(std::move(predicate));
         }
 
         template<typename F>
@@ -202,11 +401,136 @@ namespace kstd::streams {
         template<typename F>
         [[nodiscard]] constexpr auto peek_all(F function) noexcept -> Stream<BufferedPipe<PipeType, F>> {
             using Pipe = BufferedPipe<PipeType, F>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(function)}};
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(function), "peek_all"}};
+        }
+
+        template<typename P>
+        [[nodiscard]] constexpr auto zip(Stream<P>&& other) noexcept -> Stream<ZipPipe<PipeType, P>> {
+            using Pipe = ZipPipe<PipeType, P>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(other._pipe)}};
+        }
+
+        template<typename... P>
+        [[nodiscard]] constexpr auto merge(Stream<P>&&... others) noexcept
+                -> Stream<MergePipe<decltype(comparators::less_than), PipeType, P...>> {
+            using Pipe = MergePipe<decltype(comparators::less_than), PipeType, P...>;
+            return Stream<Pipe> {Pipe {comparators::less_than, std::move(_pipe), std::move(others._pipe)...}};
+        }
+
+        template<typename F, typename... P>
+            requires(std::is_invocable_r_v<bool, const F&, const NakedValueType&, const NakedValueType&>)
+        [[nodiscard]] constexpr auto merge(F comparator, Stream<P>&&... others) noexcept
+                -> Stream<MergePipe<F, PipeType, P...>> {
+            using Pipe = MergePipe<F, PipeType, P...>;
+            return Stream<Pipe> {Pipe {std::move(comparator), std::move(_pipe), std::move(others._pipe)...}};
+        }
+
+        // The build side is held in memory, pass the smaller of both streams as build
+        template<typename P, typename PK, typename BK>
+        [[nodiscard]] constexpr auto join(Stream<P>&& build, PK probe_key, BK build_key) noexcept
+                -> Stream<JoinPipe<PipeType, P, PK, BK, JoinKind::INNER>> {
+            using Pipe = JoinPipe<PipeType, P, PK, BK, JoinKind::INNER>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(build._pipe), std::move(probe_key), build_key}};
+        }
+
+        template<typename P, typename PK, typename BK>
+        [[nodiscard]] constexpr auto semi_join(Stream<P>&& build, PK probe_key, BK build_key) noexcept
+                -> Stream<JoinPipe<PipeType, P, PK, BK, JoinKind::SEMI>> {
+            using Pipe = JoinPipe<PipeType, P, PK, BK, JoinKind::SEMI>;
+            return Stream<Pipe> {
+                    Pipe {std::move(_pipe), std::move(build._pipe), std::move(probe_key), build_key, "semi_join"}};
+        }
+
+        template<typename P, typename PK, typename BK>
+        [[nodiscard]] constexpr auto anti_join(Stream<P>&& build, PK probe_key, BK build_key) noexcept
+                -> Stream<JoinPipe<PipeType, P, PK, BK, JoinKind::ANTI>> {
+            using Pipe = JoinPipe<PipeType, P, PK, BK, JoinKind::ANTI>;
+            return Stream<Pipe> {
+                    Pipe {std::move(_pipe), std::move(build._pipe), std::move(probe_key), build_key, "anti_join"}};
+        }
+
+        template<typename P, typename F = decltype(comparators::less_than)>
+        [[nodiscard]] constexpr auto intersect_sorted(Stream<P>&& other, F comparator = comparators::less_than) noexcept
+                -> Stream<SetOperationPipe<PipeType, P, F, SetOperation::INTERSECTION>> {
+            using Pipe = SetOperationPipe<PipeType, P, F, SetOperation::INTERSECTION>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(other._pipe), std::move(comparator)}};
+        }
+
+        template<typename P, typename F = decltype(comparators::less_than)>
+        [[nodiscard]] constexpr auto union_sorted(Stream<P>&& other, F comparator = comparators::less_than) noexcept
+                -> Stream<SetOperationPipe<PipeType, P, F, SetOperation::UNION>> {
+            using Pipe = SetOperationPipe<PipeType, P, F, SetOperation::UNION>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(other._pipe), std::move(comparator)}};
+        }
+
+        template<typename P, typename F = decltype(comparators::less_than)>
+        [[nodiscard]] constexpr auto difference_sorted(Stream<P>&& other,
+                                                       F comparator = comparators::less_than) noexcept
+                -> Stream<SetOperationPipe<PipeType, P, F, SetOperation::DIFFERENCE>> {
+            using Pipe = SetOperationPipe<PipeType, P, F, SetOperation::DIFFERENCE>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(other._pipe), std::move(comparator)}};
+        }
+
+        [[nodiscard]] auto sample_fraction(f64 probability, u64 seed = std::random_device {}()) noexcept
+                -> Stream<SamplePipe<PipeType>> {
+            using Pipe = SamplePipe<PipeType>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), probability, seed}};
+        }
+
+        // Constant memory alternative to distinct() for streams which are already sorted
+        [[nodiscard]] constexpr auto distinct_sorted() noexcept -> Stream<DistinctSortedPipe<PipeType>> {
+            using Pipe = DistinctSortedPipe<PipeType>;
+            return Stream<Pipe> {Pipe {std::move(_pipe)}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto group_runs(F key_mapper) noexcept -> Stream<RunPipe<PipeType, F>> {
+            using Pipe = RunPipe<PipeType, F>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(key_mapper)}};
+        }
+
+        // Erases the pipe type, e.g. to pass streams across module boundaries without templating the interface
+        [[nodiscard]] auto as_any() noexcept -> Stream<AnyPipe<ValueType>> {
+            using Pipe = AnyPipe<ValueType>;
+            return Stream<Pipe> {Pipe {std::move(_pipe)}};
+        }
+
+        [[nodiscard]] constexpr auto enumerate(usize start = 0) noexcept -> Stream<EnumeratePipe<PipeType>> {
+            using Pipe = EnumeratePipe<PipeType>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), start}};
+        }
+
+        [[nodiscard]] constexpr auto chunk(usize size) noexcept -> Stream<WindowPipe<PipeType>> {
+            using Pipe = WindowPipe<PipeType>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), size, size, true}};
+        }
+
+        [[nodiscard]] constexpr auto window(usize size, usize step = 1) noexcept -> Stream<WindowPipe<PipeType>> {
+            using Pipe = WindowPipe<PipeType>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), size, step, false}};
+        }
+
+        template<bool ENABLED = profiling::is_enabled>
+        [[nodiscard]] constexpr auto profile(const char* name) noexcept -> decltype(auto) {
+            if constexpr(ENABLED) {
+                using Pipe = ProfilePipe<PipeType>;
+                return Stream<Pipe> {Pipe {std::move(_pipe), name}};
+            }
+            else {
+                return Stream<PipeType> {std::move(_pipe)};
+            }
+        }
+
+        template<usize INDEX>
+        [[nodiscard]] constexpr auto column() noexcept
+                -> Stream<std::remove_cv_t<decltype(std::declval<PipeType&>().template get_column<INDEX>())>> {
+            using Pipe = std::remove_cv_t<decltype(_pipe.template get_column<INDEX>())>;
+            return Stream<Pipe> {_pipe.template get_column<INDEX>()};
         }
 
         template<typename F>
         constexpr auto for_each(F&& function) noexcept -> void {
+            const tracing::Scope<> scope {"for_each", "terminal"};
             auto element = _pipe.get_next();
             while(element) {
                 function(*element);
@@ -217,6 +541,7 @@ namespace kstd::streams {
         template<typename F>
         [[nodiscard]] constexpr auto reduce(F function, NakedValueType value = NakedValueType {}) noexcept
                 -> NakedValueType {
+            const tracing::Scope<> scope {"reduce", "terminal"};
             auto element = _pipe.get_next();
             while(element) {
                 value = function(value, *element);
@@ -225,11 +550,11 @@ namespace kstd::streams {
             return value;
         }
 
-        [[nodiscard]] constexpr auto distinct() noexcept
+        [[nodiscard]] constexpr auto distinct(std::vector<NakedValueType>* storage = nullptr) noexcept
                 -> Stream<BufferedPipe<PipeType, decltype(make_distinct_callback())>> {
             auto callback = make_distinct_callback();
             using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "distinct", storage}};
         }
 
         [[nodiscard]] constexpr auto distinct_by_address() noexcept -> decltype(auto) {
@@ -244,29 +569,173 @@ namespace kstd::streams {
             return reduce(reducers::add);
         }
 
-        [[nodiscard]] constexpr auto count() noexcept -> usize {
-            usize count = 0;
+        [[nodiscard]] constexpr auto summarize() noexcept -> Summary<NakedValueType> {
+            const tracing::Scope<> scope {"summarize", "terminal"};
+            if constexpr(PipeType::is_contiguous) {
+                return Summary<NakedValueType>::of(_pipe.get_data(), _pipe.get_source_size());
+            }
+            else {
+                Summary<NakedValueType> result {};
+                auto element = _pipe.get_next();
+                while(element) {
+                    result.push(*element);
+                    element = _pipe.get_next();
+                }
+                return result;
+            }
+        }
+
+        // Sized for the number of elements in the stream, unsized streams buffer their hashes until the count is known
+        [[nodiscard]] auto collect_bloom_filter(
+                f64 false_positive_rate = BloomFilter<NakedValueType>::default_false_positive_rate) noexcept
+                -> BloomFilter<NakedValueType> {
+            const tracing::Scope<> scope {"collect_bloom_filter", "terminal"};
+            if constexpr(PipeType::is_sized) {
+                BloomFilter<NakedValueType> result {_pipe.get_source_size(), false_positive_rate};
+                collectors::insert(_pipe, result);
+                return result;
+            }
+            else {
+                std::vector<u64> hashes {};
+                auto element = _pipe.get_next();
+                while(element) {
+                    hashes.push_back(hashing::hash(*element));
+                    element = _pipe.get_next();
+                }
+                BloomFilter<NakedValueType> result {hashes.size(), false_positive_rate};
+                for(const auto hash : hashes) {
+                    result.insert_hash(hash);
+                }
+                return result;
+            }
+        }
+
+        [[nodiscard]] auto sketch_distinct(u8 precision = HyperLogLog::default_precision) noexcept -> HyperLogLog {
+            const tracing::Scope<> scope {"sketch_distinct", "terminal"};
+            HyperLogLog result {precision};
             auto element = _pipe.get_next();
             while(element) {
-                ++count;
+                result.add(*element);
                 element = _pipe.get_next();
             }
-            return count;
+            return result;
         }
 
-        template<typename F>
-        [[nodiscard]] constexpr auto index_of(F predicate) noexcept -> usize {
-            usize index = 0;
+        [[nodiscard]] auto approx_distinct_count(u8 precision = HyperLogLog::default_precision) noexcept -> usize {
+            return static_cast<usize>(std::llround(sketch_distinct(precision).get_estimate()));
+        }
+
+        [[nodiscard]] auto quantile_sketch(usize accuracy = KllSketch<NakedValueType>::default_accuracy,
+                                           u64 seed = std::random_device {}()) noexcept -> KllSketch<NakedValueType> {
+            const tracing::Scope<> scope {"quantile_sketch", "terminal"};
+            KllSketch<NakedValueType> result {accuracy, seed};
             auto element = _pipe.get_next();
-            while(element && !predicate(*element)) {
-                ++index;
+            while(element) {
+                result.push(*element);
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        [[nodiscard]] auto approx_quantiles(const std::vector<f64>& ranks,
+                                            usize accuracy = KllSketch<NakedValueType>::default_accuracy,
+                                            u64 seed = std::random_device {}()) noexcept
+                -> std::vector<NakedValueType> {
+            return quantile_sketch(accuracy, seed).get_quantiles(ranks);
+        }
+
+        // Exact element at index floor(rank * count) of the sorted stream, without sorting all of it
+        [[nodiscard]] constexpr auto quantile(f64 rank) noexcept -> Option<NakedValueType> {
+            const tracing::Scope<> scope {"quantile", "terminal"};
+            std::vector<NakedValueType> buffer {};
+            if constexpr(PipeType::is_sized) {
+                buffer.reserve(_pipe.get_source_size());
+            }
+            auto element = _pipe.get_next();
+            while(element) {
+                buffer.push_back(*element);
+                element = _pipe.get_next();
+            }
+            if(buffer.empty()) {
+                return {};
+            }
+            const auto scaled_index = static_cast<usize>(std::clamp(rank, 0.0, 1.0) * static_cast<f64>(buffer.size()));
+            const auto index = std::min(scaled_index, buffer.size() - 1);
+            const auto nth = std::next(buffer.begin(), static_cast<isize>(index));
+            std::nth_element(buffer.begin(), nth, buffer.end());
+            return std::move(*nth);
+        }
+
+        // Reservoir sampling with Algorithm L, random numbers are only drawn for elements which enter the reservoir
+        [[nodiscard]] auto sample(usize count, u64 seed = std::random_device {}()) noexcept
+                -> std::vector<NakedValueType> {
+            const tracing::Scope<> scope {"sample", "terminal"};
+            std::vector<NakedValueType> result {};
+            if(count == 0) {
+                return result;
+            }
+            result.reserve(count);
+            auto element = _pipe.get_next();
+            while(element && result.size() < count) {
+                result.push_back(*element);
                 element = _pipe.get_next();
             }
-            return index;
+
+            random::SplitMix64 generator {seed};
+            const auto inverse_count = 1.0 / static_cast<f64>(count);
+            auto weight = std::exp(std::log(random::get_uniform(generator)) * inverse_count);
+            while(element) {
+                auto skip = random::get_geometric(generator, weight);
+                while(element && skip > 0) {
+                    element = _pipe.get_next();
+                    --skip;
+                }
+                if(!element) {
+                    break;
+                }
+                result[generator() % count] = *element;
+                weight *= std::exp(std::log(random::get_uniform(generator)) * inverse_count);
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto count() noexcept -> usize {
+            const tracing::Scope<> scope {"count", "terminal"};
+            if constexpr(requires(PipeType& pipe) { pipe.get_remaining_count(); }) {
+                return _pipe.get_remaining_count();
+            }
+            else {
+                usize count = 0;
+                auto element = _pipe.get_next();
+                while(element) {
+                    ++count;
+                    element = _pipe.get_next();
+                }
+                return count;
+            }
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto index_of(F predicate) noexcept -> usize {
+            const tracing::Scope<> scope {"index_of", "terminal"};
+            if constexpr(is_scannable<F>) {
+                return scan::find(_pipe.get_data(), _pipe.get_source_size(), predicate);
+            }
+            else {
+                usize index = 0;
+                auto element = _pipe.get_next();
+                while(element && !predicate(*element)) {
+                    ++index;
+                    element = _pipe.get_next();
+                }
+                return index;
+            }
         }
 
         template<typename F>
         [[nodiscard]] constexpr auto index_of_last(F predicate) noexcept -> usize {
+            const tracing::Scope<> scope {"index_of_last", "terminal"};
             usize index = 0;
             usize result = 0;
             auto element = _pipe.get_next();
@@ -282,15 +751,27 @@ namespace kstd::streams {
 
         template<typename F>
         [[nodiscard]] constexpr auto find_first(F predicate) noexcept -> Option<ValueType> {
-            auto element = _pipe.get_next();
-            while(element && !predicate(*element)) {
-                element = _pipe.get_next();
+            const tracing::Scope<> scope {"find_first", "terminal"};
+            if constexpr(is_scannable<F>) {
+                const auto size = _pipe.get_source_size();
+                const auto index = scan::find(_pipe.get_data(), size, predicate);
+                if(index == size) {
+                    return {};
+                }
+                return _pipe.slice(index, 1).get_next();
+            }
+            else {
+                auto element = _pipe.get_next();
+                while(element && !predicate(*element)) {
+                    element = _pipe.get_next();
+                }
+                return element;
             }
-            return element;
         }
 
         template<typename F>
         [[nodiscard]] constexpr auto find_last(F predicate) noexcept -> Option<ValueType> {
+            const tracing::Scope<> scope {"find_last", "terminal"};
             auto element = _pipe.get_next();
             Option<ValueType> result {};
             while(element) {
@@ -303,13 +784,16 @@ namespace kstd::streams {
         }
 
         [[nodiscard]] constexpr auto find_any() noexcept -> Option<ValueType> {
+            const tracing::Scope<> scope {"find_any", "terminal"};
             return _pipe.get_next();
         }
 
-        [[nodiscard]] constexpr auto sort() noexcept -> Stream<BufferedPipe<PipeType, decltype(make_sort_callback())>> {
+        // A storage vector may be passed to buffered stages, its capacity is reused and it receives the buffer back
+        [[nodiscard]] constexpr auto sort(std::vector<NakedValueType>* storage = nullptr) noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_sort_callback())>> {
             auto callback = make_sort_callback();
             using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "sort", storage}};
         }
 
         template<typename F>
@@ -317,14 +801,14 @@ namespace kstd::streams {
                 -> Stream<BufferedPipe<PipeType, decltype(make_sort_callback(std::move(comparator)))>> {
             auto callback = make_sort_callback(std::move(comparator));
             using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "sort"}};
         }
 
-        [[nodiscard]] constexpr auto reverse_sort() noexcept
+        [[nodiscard]] constexpr auto reverse_sort(std::vector<NakedValueType>* storage = nullptr) noexcept
                 -> Stream<BufferedPipe<PipeType, decltype(make_reverse_sort_callback())>> {
             auto callback = make_reverse_sort_callback();
             using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "reverse_sort", storage}};
         }
 
         template<typename F>
@@ -332,23 +816,113 @@ namespace kstd::streams {
                 -> Stream<BufferedPipe<PipeType, decltype(make_reverse_sort_callback(std::move(comparator)))>> {
             auto callback = make_reverse_sort_callback(std::move(comparator));
             using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "reverse_sort"}};
+        }
+
+        // Spilling is limited to max_memory bytes of buffered elements. If a run can't be written to or read back
+        // from its temporary file, *failed is set and the stream ends early instead of exceeding the budget
+        template<typename F = decltype(comparators::less_than), typename S = serializers::Trivial>
+        [[nodiscard]] auto sort_external(usize max_memory, F comparator = comparators::less_than,
+                                         S serializer = serializers::trivial, bool* failed = nullptr) noexcept
+                -> Stream<ExternalSortPipe<PipeType, F, S>> {
+            using Pipe = ExternalSortPipe<PipeType, F, S>;
+            return Stream<Pipe> {
+                    Pipe {std::move(_pipe), max_memory, std::move(comparator), std::move(serializer), failed}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto sort_by(F key_mapper) noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_sort_by_callback<false>(std::move(key_mapper)))>> {
+            auto callback = make_sort_by_callback<false>(std::move(key_mapper));
+            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "sort_by"}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto reverse_sort_by(F key_mapper) noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_sort_by_callback<true>(std::move(key_mapper)))>> {
+            auto callback = make_sort_by_callback<true>(std::move(key_mapper));
+            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "reverse_sort_by"}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto sort_by_key(F key_mapper) noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_sort_by_key_callback<false>(std::move(key_mapper)))>> {
+            auto callback = make_sort_by_key_callback<false>(std::move(key_mapper));
+            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "sort_by_key"}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto reverse_sort_by_key(F key_mapper) noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_sort_by_key_callback<true>(std::move(key_mapper)))>> {
+            auto callback = make_sort_by_key_callback<true>(std::move(key_mapper));
+            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback), "reverse_sort_by_key"}};
         }
 
         template<template<typename, typename...> typename CONTAINER, typename... PROPS, typename COLLECTOR,
                  typename... ARGS>
         [[nodiscard]] constexpr auto collect(COLLECTOR collector, ARGS&&... args) noexcept
                 -> CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...> {
+            const tracing::Scope<> scope {"collect", "terminal"};
             CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...> result {
                     std::forward<ARGS>(args)...};
             collector(_pipe, result);
             return result;
         }
 
+        // Every chunk is pulled through its own slice of the pipe on a separate thread, so the callables of all
+        // upstream stages (filter, map, peek, ...) run concurrently and must not mutate shared state unsynchronized
+        template<template<typename, typename...> typename CONTAINER = std::vector, typename... PROPS>
+        [[nodiscard]] auto collect_parallel(usize num_threads = 0) noexcept -> CONTAINER<NakedValueType, PROPS...> {
+            const tracing::Scope<> scope {"collect_parallel", "terminal"};
+            CONTAINER<NakedValueType, PROPS...> result {};
+            if constexpr(PipeType::is_random_access) {
+                const auto size = _pipe.get_source_size();
+                const auto num_chunks = parallel::get_chunk_count(size, num_threads);
+                if(num_chunks > 1) {
+                    std::vector<std::vector<NakedValueType>> buffers(num_chunks);
+                    parallel::invoke(num_chunks, [this, &buffers, size, num_chunks](usize index) noexcept -> void {
+                        const tracing::Scope<> batch_scope {"batch", "parallel"};
+                        const auto [offset, count] = parallel::get_chunk(size, num_chunks, index);
+                        auto pipe = _pipe.slice(offset, count);
+                        collectors::push_back(pipe, buffers[index]);
+                    });
+
+                    std::vector<usize> offsets(num_chunks + 1);
+                    for(usize index = 0; index < num_chunks; ++index) {
+                        offsets[index + 1] = offsets[index] + buffers[index].size();
+                    }
+
+                    if constexpr(std::is_default_constructible_v<NakedValueType>) {
+                        result.resize(offsets[num_chunks]);
+                        parallel::invoke(num_chunks, [&result, &buffers, &offsets](usize index) noexcept -> void {
+                            const tracing::Scope<> batch_scope {"concatenate", "parallel"};
+                            auto& buffer = buffers[index];
+                            const auto offset = static_cast<isize>(offsets[index]);
+                            std::move(buffer.begin(), buffer.end(), std::next(result.begin(), offset));
+                        });
+                    }
+                    else {
+                        result.reserve(offsets[num_chunks]);
+                        for(auto& buffer : buffers) {
+                            std::move(buffer.begin(), buffer.end(), std::back_inserter(result));
+                        }
+                    }
+                    return result;
+                }
+            }
+            collectors::push_back(_pipe, result);
+            return result;
+        }
+
         template<template<typename, typename...> typename CONTAINER, typename... PROPS, typename COLLECTOR>
         constexpr auto
         collect_into(CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...>& container,
                      COLLECTOR collector) noexcept -> void {
+            const tracing::Scope<> scope {"collect_into", "terminal"};
             collector(_pipe, container);
         }
 
@@ -356,6 +930,7 @@ namespace kstd::streams {
                  typename... ARGS>
         [[nodiscard]] constexpr auto collect_map(KM key_mapper, VM value_mapper, ARGS&&... args) noexcept
                 -> MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...> {
+            const tracing::Scope<> scope {"collect_map", "terminal"};
             MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...> result {
                     std::forward<ARGS>(args)...};
             auto element = _pipe.get_next();
@@ -367,10 +942,18 @@ namespace kstd::streams {
             return result;
         }
 
+        // Collects into an existing result, which does not have to be a container of the stream's value type
+        template<typename RESULT, typename COLLECTOR>
+        constexpr auto collect_into(RESULT& result, COLLECTOR collector) noexcept -> void {
+            const tracing::Scope<> scope {"collect_into", "terminal"};
+            collector(_pipe, result);
+        }
+
         template<template<typename, typename, typename...> typename MAP, typename... PROPS, typename KM, typename VM>
         constexpr auto
         collect_map_into(MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...>& map,
                          KM key_mapper, VM value_mapper) noexcept -> void {
+            const tracing::Scope<> scope {"collect_map_into", "terminal"};
             auto element = _pipe.get_next();
             while(element) {
                 auto& value = *element;
@@ -380,6 +963,9 @@ namespace kstd::streams {
         }
     };
 
+    template<typename T>
+    using AnyStream = Stream<AnyPipe<T>>;
+
     template<typename ITERATOR>
     [[nodiscard]] constexpr auto stream(ITERATOR begin, ITERATOR end) noexcept -> Stream<IteratorPipe<ITERATOR>> {
         using Pipe = IteratorPipe<ITERATOR>;
@@ -398,6 +984,16 @@ namespace kstd::streams {
         return stream<typename CONTAINER::const_iterator>(container.cbegin(), container.cend());
     }
 
+    // Columns are referenced, so temporaries are only accepted for views like std::span which don't own their elements
+    template<typename... CONTAINERS>
+        requires((std::is_lvalue_reference_v<CONTAINERS> || std::ranges::borrowed_range<CONTAINERS>) && ...)
+    [[nodiscard]] constexpr auto stream_columns(CONTAINERS&&... columns) noexcept
+            -> Stream<ColumnPipe<std::remove_reference_t<decltype(*std::data(columns))>...>> {
+        using Pipe = ColumnPipe<std::remove_reference_t<decltype(*std::data(columns))>...>;
+        const auto size = std::min({static_cast<usize>(std::size(columns))...});
+        return Stream<Pipe> {Pipe {{std::data(columns)...}, 0, size}};
+    }
+
     template<typename SUPPLIER>
     [[nodiscard]] constexpr auto stream_until_empty(SUPPLIER supplier) noexcept -> Stream<SupplierPipe<SUPPLIER>> {
         using Pipe = SupplierPipe<SUPPLIER>;
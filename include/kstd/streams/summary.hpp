@@ -0,0 +1,159 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+
+namespace kstd::streams {
+    template<typename T>
+    struct Summary final {
+        // clang-format off
+        using ValueType     = T;
+        using Self          = Summary<ValueType>;
+        using SumType       = std::conditional_t<std::is_floating_point_v<ValueType>, f64,
+                                std::conditional_t<std::is_signed_v<ValueType>, i64, u64>>;
+        // clang-format on
+
+        static_assert(std::is_arithmetic_v<ValueType>, "Summary requires an arithmetic value type");
+
+        // Contiguous input is reduced in blocks of this size, then the blocks are merged
+        static constexpr usize block_size = 1024;
+        static constexpr usize lane_count = 8;
+
+        usize count;
+        SumType sum;
+        ValueType min;
+        ValueType max;
+        f64 mean;
+        f64 m2;// Sum of squared deviations from the mean
+
+        [[nodiscard]] static constexpr auto of(const ValueType* data, usize size) noexcept -> Self {
+            Self result {};
+            for(usize offset = 0; offset < size; offset += block_size) {
+                result.merge(of_block(data + offset, std::min(block_size, size - offset)));
+            }
+            return result;
+        }
+
+        // Two passes over a block that fits into L1, written with independent lanes so the loops vectorize
+        [[nodiscard]] static constexpr auto of_block(const ValueType* data, usize size) noexcept -> Self {
+            if(size == 0) {
+                return {};
+            }
+            SumType sums[lane_count] {};
+            ValueType mins[lane_count] {};
+            ValueType maxs[lane_count] {};
+            for(usize lane = 0; lane < lane_count; ++lane) {
+                mins[lane] = data[0];
+                maxs[lane] = data[0];
+            }
+
+            usize index = 0;
+            for(; index + lane_count <= size; index += lane_count) {
+                for(usize lane = 0; lane < lane_count; ++lane) {
+                    const auto value = data[index + lane];
+                    sums[lane] += static_cast<SumType>(value);
+                    mins[lane] = value < mins[lane] ? value : mins[lane];
+                    maxs[lane] = value > maxs[lane] ? value : maxs[lane];
+                }
+            }
+            for(; index < size; ++index) {
+                const auto value = data[index];
+                sums[0] += static_cast<SumType>(value);
+                mins[0] = value < mins[0] ? value : mins[0];
+                maxs[0] = value > maxs[0] ? value : maxs[0];
+            }
+
+            Self result {size, 0, mins[0], maxs[0], 0.0, 0.0};
+            for(usize lane = 0; lane < lane_count; ++lane) {
+                result.sum += sums[lane];
+                result.min = std::min(result.min, mins[lane]);
+                result.max = std::max(result.max, maxs[lane]);
+            }
+            result.mean = static_cast<f64>(result.sum) / static_cast<f64>(size);
+
+            f64 squares[lane_count] {};
+            index = 0;
+            for(; index + lane_count <= size; index += lane_count) {
+                for(usize lane = 0; lane < lane_count; ++lane) {
+                    const auto delta = static_cast<f64>(data[index + lane]) - result.mean;
+                    squares[lane] += delta * delta;
+                }
+            }
+            for(; index < size; ++index) {
+                const auto delta = static_cast<f64>(data[index]) - result.mean;
+                squares[0] += delta * delta;
+            }
+            for(usize lane = 0; lane < lane_count; ++lane) {
+                result.m2 += squares[lane];
+            }
+            return result;
+        }
+
+        // Welford's online update
+        constexpr auto push(ValueType value) noexcept -> void {
+            if(count == 0) {
+                min = value;
+                max = value;
+            }
+            else {
+                min = std::min(min, value);
+                max = std::max(max, value);
+            }
+            ++count;
+            sum += static_cast<SumType>(value);
+            const auto delta = static_cast<f64>(value) - mean;
+            mean += delta / static_cast<f64>(count);
+            m2 += delta * (static_cast<f64>(value) - mean);
+        }
+
+        // Chan et al. pairwise combination of two partial summaries
+        constexpr auto merge(const Self& other) noexcept -> void {
+            if(other.count == 0) {
+                return;
+            }
+            if(count == 0) {
+                *this = other;
+                return;
+            }
+            const auto total = count + other.count;
+            const auto delta = other.mean - mean;
+            const auto weight = static_cast<f64>(other.count) / static_cast<f64>(total);
+            mean += delta * weight;
+            m2 += other.m2 + (delta * delta * static_cast<f64>(count) * weight);
+            sum += other.sum;
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+            count = total;
+        }
+
+        [[nodiscard]] constexpr auto get_variance() const noexcept -> f64 {
+            return count == 0 ? 0.0 : m2 / static_cast<f64>(count);
+        }
+
+        [[nodiscard]] constexpr auto get_sample_variance() const noexcept -> f64 {
+            return count < 2 ? 0.0 : m2 / static_cast<f64>(count - 1);
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
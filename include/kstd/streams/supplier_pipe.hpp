@@ -32,6 +32,11 @@ namespace kstd::streams {
         using ValueType     = typename decltype(std::declval<SupplierType&&>()())::value_type;
         // clang-format on
 
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = false;
+
         private:
         SupplierType _supplier;
 
@@ -0,0 +1,149 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fmt/format.h>
+#include <iterator>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace kstd::streams::tracing {
+#ifdef KSTD_STREAMS_TRACING
+    constexpr bool is_enabled = true;
+#else
+    constexpr bool is_enabled = false;
+#endif
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Event final {
+        const char* name;
+        const char* category;
+        char phase;
+        u32 thread_id;
+        std::chrono::nanoseconds timestamp;
+    };
+
+    struct Sink final {
+        std::mutex mutex;
+        std::vector<Event> events;
+        std::atomic_bool is_recording;
+        Clock::time_point origin;
+    };
+
+    [[nodiscard]] inline auto get_sink() noexcept -> Sink& {
+        static Sink sink {};
+        return sink;
+    }
+
+    [[nodiscard]] inline auto get_thread_id() noexcept -> u32 {
+        static std::atomic<u32> next_id {1};
+        thread_local const auto id = next_id.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    [[nodiscard]] inline auto is_recording() noexcept -> bool {
+        return get_sink().is_recording.load(std::memory_order_relaxed);
+    }
+
+    inline auto record(const char* name, const char* category, char phase) noexcept -> void {
+        auto& sink = get_sink();
+        const auto timestamp = Clock::now();
+        const std::lock_guard lock {sink.mutex};
+        sink.events.push_back({name, category, phase, get_thread_id(), timestamp - sink.origin});
+    }
+
+    inline auto start() noexcept -> void {
+        auto& sink = get_sink();
+        const std::lock_guard lock {sink.mutex};
+        sink.events.clear();
+        sink.origin = Clock::now();
+        sink.is_recording.store(true, std::memory_order_relaxed);
+    }
+
+    // Stops recording and writes all events as Chrome trace JSON, loadable by chrome://tracing and Perfetto
+    inline auto stop(const char* path) noexcept -> bool {
+        auto& sink = get_sink();
+        sink.is_recording.store(false, std::memory_order_relaxed);
+        const std::lock_guard lock {sink.mutex};
+        auto* file = std::fopen(path, "w");
+        if(file == nullptr) {
+            return false;
+        }
+        fmt::memory_buffer buffer {};
+        fmt::format_to(std::back_inserter(buffer), "{{\"traceEvents\":[");
+        for(usize index = 0; index < sink.events.size(); ++index) {
+            const auto& event = sink.events[index];
+            fmt::format_to(std::back_inserter(buffer),
+                           "{}{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"{}\",\"pid\":1,\"tid\":{},\"ts\":{:.3f}}}",
+                           index == 0 ? "" : ",", event.name, event.category, event.phase, event.thread_id,
+                           static_cast<f64>(event.timestamp.count()) / 1000.0);
+        }
+        fmt::format_to(std::back_inserter(buffer), "],\"displayTimeUnit\":\"ns\"}}\n");
+        sink.events.clear();
+        const auto written = std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+        return (std::fclose(file) == 0) && written;
+    }
+
+    // Records nothing during constant evaluation, so traced code stays usable in constant expressions
+    template<bool ENABLED = is_enabled>
+    class Scope final {
+        const char* _name;
+        const char* _category;
+        bool _is_recording;
+
+        public:
+        KSTD_NO_MOVE_COPY(Scope, Scope<ENABLED>, constexpr)
+
+        constexpr Scope(const char* name, const char* category) noexcept :
+                _name {name},
+                _category {category},
+                _is_recording {false} {
+            if(!std::is_constant_evaluated() && is_recording()) {
+                _is_recording = true;
+                record(_name, _category, 'B');
+            }
+        }
+
+        constexpr ~Scope() noexcept {
+            if(_is_recording) {
+                record(_name, _category, 'E');
+            }
+        }
+    };
+
+    template<>
+    class Scope<false> final {
+        public:
+        KSTD_NO_MOVE_COPY(Scope, Scope<false>, constexpr)
+
+        constexpr Scope(const char*, const char*) noexcept {
+        }
+
+        constexpr ~Scope() noexcept = default;
+    };
+}// namespace kstd::streams::tracing
\ No newline at end of file
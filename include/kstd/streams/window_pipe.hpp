@@ -0,0 +1,156 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace kstd::streams {
+    template<typename PIPE, bool CONTIGUOUS = PIPE::is_contiguous>
+    struct WindowElement final {
+        using Type = std::remove_cv_t<std::remove_reference_t<typename PIPE::ValueType>>;
+    };
+
+    template<typename PIPE>
+    struct WindowElement<PIPE, true> final {
+        using Type = typename PIPE::ElementType;
+    };
+
+    template<typename PIPE>
+    struct WindowPipe final {
+        // clang-format off
+        using PipeType      = PIPE;
+        using Self          = WindowPipe<PipeType>;
+        using ElementType   = typename WindowElement<PipeType>::Type;
+        using ValueType     = std::span<ElementType>;
+        using BufferType    = std::vector<std::remove_cv_t<ElementType>>;
+        // clang-format on
+
+        static constexpr bool is_random_access = false;
+        static constexpr bool is_sized = false;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = false;// Windows borrow from the pipe's buffer
+
+        private:
+        PipeType _pipe;
+        usize _size;
+        usize _step;
+        bool _partial;
+        bool _is_first;
+        usize _position;// Offset into the source if contiguous, otherwise into the buffer
+        BufferType _buffer;
+
+        [[nodiscard]] constexpr auto get_next_contiguous() noexcept -> Option<ValueType> {
+            const auto source_size = _pipe.get_source_size();
+            if(_position >= source_size) {
+                return {};
+            }
+            const auto remaining = source_size - _position;
+            if(remaining < _size && !_partial) {
+                _position = source_size;
+                return {};
+            }
+            ValueType result {_pipe.get_data() + _position, std::min(remaining, _size)};
+            _position += _step;
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto get_next_buffered() noexcept -> Option<ValueType> {
+            if(!_is_first) {
+                const auto remaining = _buffer.size() - _position;
+                if(_step >= remaining) {
+                    _buffer.clear();
+                    _position = 0;
+                    for(usize skipped = remaining; skipped < _step; ++skipped) {
+                        if(!_pipe.get_next()) {
+                            return {};
+                        }
+                    }
+                }
+                else {
+                    _position += _step;
+                }
+            }
+            _is_first = false;
+
+            // Compact the buffer instead of growing it, so windows never reallocate
+            if(_position + _size > _buffer.capacity()) {
+                std::move(_buffer.begin() + static_cast<isize>(_position), _buffer.end(), _buffer.begin());
+                _buffer.resize(_buffer.size() - _position);
+                _position = 0;
+            }
+            while(_buffer.size() - _position < _size) {
+                auto element = _pipe.get_next();
+                if(!element) {
+                    break;
+                }
+                _buffer.push_back(*element);
+            }
+
+            const auto available = _buffer.size() - _position;
+            if(available == 0 || (available < _size && !_partial)) {
+                return {};
+            }
+            return ValueType {_buffer.data() + _position, std::min(available, _size)};
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(WindowPipe, Self, constexpr)
+
+        constexpr WindowPipe() noexcept :
+                _pipe {},
+                _size {1},
+                _step {1},
+                _partial {false},
+                _is_first {true},
+                _position {0},
+                _buffer {} {
+        }
+
+        constexpr WindowPipe(PipeType pipe, usize size, usize step, bool partial) noexcept :
+                _pipe {std::move(pipe)},
+                _size {std::max<usize>(size, 1)},
+                _step {std::max<usize>(step, 1)},
+                _partial {partial},
+                _is_first {true},
+                _position {0},
+                _buffer {} {
+            if constexpr(!PipeType::is_contiguous) {
+                _buffer.reserve(_size << 1);
+            }
+        }
+
+        ~WindowPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            if constexpr(PipeType::is_contiguous) {
+                return get_next_contiguous();
+            }
+            else {
+                return get_next_buffered();
+            }
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,117 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace kstd::streams {
+    // Pair of (possibly reference) values, assignment rebinds the references instead of writing through them
+    template<typename FIRST, typename SECOND>
+    struct Zipped final {
+        // clang-format off
+        using FirstType     = FIRST;
+        using SecondType    = SECOND;
+        using Self          = Zipped<FirstType, SecondType>;
+        // clang-format on
+
+        FirstType first;
+        SecondType second;
+
+        constexpr Zipped(FirstType first, SecondType second) noexcept :
+                first {std::forward<FirstType>(first)},
+                second {std::forward<SecondType>(second)} {
+        }
+
+        constexpr Zipped(const Self& other) noexcept = default;
+
+        constexpr auto operator=(const Self& other) noexcept -> Self& {
+            if(this != &other) {
+                std::destroy_at(this);
+                std::construct_at(this, other);
+            }
+            return *this;
+        }
+
+        ~Zipped() noexcept = default;
+    };
+
+    template<typename LHS, typename RHS>
+    struct ZipPipe final {
+        // clang-format off
+        using LhsPipeType   = LHS;
+        using RhsPipeType   = RHS;
+        using Self          = ZipPipe<LhsPipeType, RhsPipeType>;
+        using ValueType     = Zipped<typename LhsPipeType::ValueType, typename RhsPipeType::ValueType>;
+        // clang-format on
+
+        static constexpr bool is_sized = LhsPipeType::is_sized && RhsPipeType::is_sized;
+        static constexpr bool is_random_access = is_sized;
+        static constexpr bool is_contiguous = false;
+        static constexpr bool is_prefetchable = LhsPipeType::is_prefetchable && RhsPipeType::is_prefetchable;
+
+        private:
+        LhsPipeType _lhs;
+        RhsPipeType _rhs;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(ZipPipe, Self, constexpr)
+
+        constexpr ZipPipe() noexcept :
+                _lhs {},
+                _rhs {} {
+        }
+
+        constexpr ZipPipe(LhsPipeType lhs, RhsPipeType rhs) noexcept :
+                _lhs {std::move(lhs)},
+                _rhs {std::move(rhs)} {
+        }
+
+        ~ZipPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            auto lhs = _lhs.get_next();
+            if(!lhs) {
+                return {};
+            }
+            auto rhs = _rhs.get_next();
+            if(!rhs) {
+                return {};
+            }
+            return ValueType {std::forward<typename LhsPipeType::ValueType>(*lhs),
+                              std::forward<typename RhsPipeType::ValueType>(*rhs)};
+        }
+
+        [[nodiscard]] constexpr auto get_source_size() const noexcept -> usize {
+            return std::min(_lhs.get_source_size(), _rhs.get_source_size());
+        }
+
+        [[nodiscard]] constexpr auto slice(usize offset, usize count) const noexcept -> decltype(auto) {
+            using SlicedLhsPipe = std::remove_cv_t<decltype(_lhs.slice(offset, count))>;
+            using SlicedRhsPipe = std::remove_cv_t<decltype(_rhs.slice(offset, count))>;
+            return ZipPipe<SlicedLhsPipe, SlicedRhsPipe> {_lhs.slice(offset, count), _rhs.slice(offset, count)};
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,134 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+    auto get_even_values(const std::vector<kstd::u32>& values) -> kstd::streams::AnyStream<const kstd::u32&> {
+        return kstd::streams::stream(values).filter(kstd::streams::filters::even).as_any();
+    }
+}// namespace
+
+TEST(kstd_streams_Stream, test_any_stream_reference) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 index = 0; index < 1000; ++index) {
+        values.push_back(index);
+    }
+
+    const auto even_values = get_even_values(values).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(even_values.size(), 500);
+    for(kstd::usize index = 0; index < even_values.size(); ++index) {
+        ASSERT_EQ(even_values[index], index << 1);
+    }
+
+    const auto first_value = get_even_values(values).find_first([](kstd::u32 value) { return value > 100; });
+    ASSERT_EQ(&(*first_value), &values[102]);
+}
+
+TEST(kstd_streams_Stream, test_any_stream_value) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector<kstd::u32> values {3, 1, 2};
+    AnyStream<std::string> strings = stream(values).sort().map(mappers::format("#{}")).as_any();
+    // clang-format off
+    const auto mapped_values = strings
+        .map([](std::string value) { return value + '!'; })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(mapped_values, (std::vector {"#1!"s, "#2!"s, "#3!"s}));
+}
+
+TEST(kstd_streams_Stream, test_any_stream_large_pipe) {
+    using namespace kstd::streams;
+
+    std::array<kstd::u32, 64> offsets {};
+    offsets.fill(1);
+    const std::vector<kstd::u32> values {1, 2, 3};
+    // The captured array does not fit into the inline storage, so the pipe is allocated
+    // clang-format off
+    const auto mapped_values = stream(values)
+        .map([offsets](kstd::u32 value) { return value + offsets[value]; })
+        .as_any()
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(mapped_values, (std::vector<kstd::u32> {2, 3, 4}));
+}
+
+TEST(kstd_streams_Stream, test_any_stream_window) {
+    using namespace kstd::streams;
+
+    std::list<kstd::u32> values(20);
+    std::iota(values.begin(), values.end(), 0U);
+    // Windows borrow from the pipe's buffer, so they must not be pulled ahead
+    // clang-format off
+    const auto sums = stream(values)
+        .window(4, 3)
+        .as_any()
+        .map([](auto window) { return std::accumulate(window.begin(), window.end(), 0U); })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(sums, (std::vector<kstd::u32> {6, 18, 30, 42, 54, 66}));
+}
+
+TEST(kstd_streams_Stream, test_any_stream_lazy) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values(1000, 1);
+    kstd::usize count = 0;
+    // clang-format off
+    const auto element = stream(values)
+        .peek([&count](auto) { ++count; })
+        .as_any()
+        .find_first([](auto) { return true; });
+    // clang-format on
+    ASSERT_TRUE(element);
+    ASSERT_EQ(count, 1);
+}
+
+TEST(kstd_streams_Stream, test_any_stream_prefetch) {
+    using namespace kstd::streams;
+
+    std::list<kstd::u32> values(1000, 1);
+    kstd::usize count = 0;
+    auto mapped_stream = stream(values).map([&count](kstd::u32 value) {
+        ++count;
+        return value << 1;
+    });
+    auto peeked_stream = stream(values).peek([](auto) {});
+    auto windowed_stream = stream(values).window(4, 1);
+    static_assert(decltype(mapped_stream)::PipeType::is_prefetchable, "Mapping owned values is pure");
+    static_assert(!decltype(peeked_stream)::PipeType::is_prefetchable, "Peeking has side effects");
+    static_assert(!decltype(windowed_stream)::PipeType::is_prefetchable, "Windows borrow from the pipe");
+
+    // Pure stages over an unsized source are still pulled a batch at a time
+    const auto element = mapped_stream.filter(filters::even).as_any().find_first([](auto) { return true; });
+    ASSERT_TRUE(element);
+    ASSERT_EQ(*element, 2);
+    ASSERT_EQ(count, AnyPipe<kstd::u32>::batch_size);
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_approx_distinct_count) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u64> values {};
+    for(kstd::u64 index = 0; index < 200000; ++index) {
+        values.push_back(index % 50000);
+    }
+    const auto count = stream(values).approx_distinct_count();
+    ASSERT_NEAR(static_cast<kstd::f64>(count), 50000.0, 50000.0 * 0.05);
+}
+
+TEST(kstd_streams_Stream, test_approx_distinct_count_small) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"a"s, "b"s, "a"s, "c"s, "b"s};
+    ASSERT_EQ(stream(values).approx_distinct_count(), 3);
+}
+
+TEST(kstd_streams_Stream, test_sketch_distinct_merge) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> lhs {};
+    std::vector<kstd::u32> rhs {};
+    for(kstd::u32 index = 0; index < 30000; ++index) {
+        lhs.push_back(index);
+        rhs.push_back(index + 10000);
+    }
+
+    auto sketch = stream(lhs).sketch_distinct(12);
+    ASSERT_TRUE(sketch.merge(stream(rhs).sketch_distinct(12)));
+    ASSERT_FALSE(sketch.merge(stream(rhs).sketch_distinct(10)));
+    ASSERT_NEAR(sketch.get_estimate(), 40000.0, 40000.0 * 0.1);
+
+    const std::vector<kstd::u8> registers {sketch.get_registers().begin(), sketch.get_registers().end()};
+    const HyperLogLog restored {sketch.get_precision(), registers};
+    ASSERT_EQ(restored.get_estimate(), sketch.get_estimate());
+}
\ No newline at end of file
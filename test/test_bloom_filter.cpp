@@ -0,0 +1,105 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_collect_bloom_filter) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u64> values {};
+    for(kstd::u64 index = 0; index < 10000; ++index) {
+        values.push_back(index * 2);
+    }
+    const auto bloom_filter = stream(values).collect<BloomFilter>(collectors::insert, values.size(), 0.01);
+
+    kstd::usize false_positives = 0;
+    for(kstd::u64 index = 0; index < 10000; ++index) {
+        ASSERT_TRUE(bloom_filter.contains(index * 2));
+        false_positives += bloom_filter.contains((index * 2) + 1) ? 1 : 0;
+    }
+    ASSERT_LT(false_positives, 300);
+}
+
+TEST(kstd_streams_Stream, test_filter_in) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector allowed {"b"s, "d"s};
+    const std::unordered_set<std::string> exact_allowed {allowed.begin(), allowed.end()};
+    const auto bloom_filter = stream(allowed).collect<BloomFilter>(collectors::insert, allowed.size());
+
+    const std::vector values {"a"s, "b"s, "c"s, "d"s, "e"s};
+    // clang-format off
+    const auto matches = stream(values)
+        .filter_in(bloom_filter, [&exact_allowed](const std::string& value) {
+            return exact_allowed.contains(value);
+        })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(matches, (std::vector {"b"s, "d"s}));
+}
+
+TEST(kstd_streams_Stream, test_filter_not_in) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> denied {3, 5, 7};
+    const auto bloom_filter = stream(denied).collect<BloomFilter>(collectors::insert, denied.size());
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 index = 0; index < 10; ++index) {
+        values.push_back(index);
+    }
+    // clang-format off
+    const auto matches = stream(values)
+        .filter_not_in(bloom_filter, [](kstd::u32 value) { return value == 3 || value == 5 || value == 7; })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(matches, (std::vector<kstd::u32> {0, 1, 2, 4, 6, 8, 9}));
+}
+
+TEST(kstd_streams_Stream, test_collect_bloom_filter_sized) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u64> values {};
+    for(kstd::u64 index = 0; index < 10000; ++index) {
+        values.push_back(index * 2);
+    }
+    const std::list<kstd::u64> list_values {values.cbegin(), values.cend()};
+    const auto bloom_filter = stream(values).collect_bloom_filter();
+    const auto list_bloom_filter = stream(list_values).collect_bloom_filter();
+    ASSERT_EQ(bloom_filter.get_block_count(), list_bloom_filter.get_block_count());
+
+    kstd::usize false_positives = 0;
+    kstd::usize list_false_positives = 0;
+    for(kstd::u64 index = 0; index < 10000; ++index) {
+        ASSERT_TRUE(bloom_filter.contains(index * 2));
+        ASSERT_TRUE(list_bloom_filter.contains(index * 2));
+        false_positives += bloom_filter.contains((index * 2) + 1) ? 1 : 0;
+        list_false_positives += list_bloom_filter.contains((index * 2) + 1) ? 1 : 0;
+    }
+    // A default rate of 1%, so about 100 false positives
+    ASSERT_LT(false_positives, 200);
+    ASSERT_LT(list_false_positives, 200);
+}
\ No newline at end of file
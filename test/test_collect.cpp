@@ -97,4 +97,54 @@ TEST(kstd_streams_Stream, test_collect_string_joining) {
     const auto num_values = values.size();
     ASSERT_EQ((num_values << 1) - 1, value.length());
     ASSERT_EQ(value, "O\tw\tO\t!");
+}
+
+TEST(kstd_streams_Stream, test_collect_string_joining_strings) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"Hello"s, "streamed"s, "World"s};
+    std::string value {};
+    stream(values).collect_into(value, collectors::joining(", "s));
+    ASSERT_EQ(value, "Hello, streamed, World");
+}
+
+TEST(kstd_streams_Stream, test_collect_format_joining) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 22, 333};
+    std::string value {"values: "};
+    stream(values).collect_into(value, collectors::format_joining("<{}>", ", "));
+    ASSERT_EQ(value, "values: <1>, <22>, <333>");
+}
+
+TEST(kstd_streams_Stream, test_collect_format_joining_strings) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"Hello"s, "World"s};
+    std::string value {};
+    stream(values).collect_into(value, collectors::format_joining("{}", " "));
+    ASSERT_EQ(value, "Hello World");
+
+    std::string empty_value {};
+    stream(std::vector<std::string> {}).collect_into(empty_value, collectors::format_joining("{}", " "));
+    ASSERT_TRUE(empty_value.empty());
+}
+
+TEST(kstd_streams_Stream, test_collect_format_joining_specs) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 22, 333};
+    std::string value {};
+    stream(values).collect_into(value, collectors::format_joining("{{{:>4}}}", ","));
+    ASSERT_EQ(value, "{   1},{  22},{ 333}");
+
+    value.clear();
+    stream(values).collect_into(value, collectors::format_joining("{0:x}h", " "));
+    ASSERT_EQ(value, "1h 16h 14dh");
+
+    value.clear();// More than one field is left to fmt
+    stream(values).collect_into(value, collectors::format_joining("{0}={0:02}", ";"));
+    ASSERT_EQ(value, "1=01;22=22;333=333");
 }
\ No newline at end of file
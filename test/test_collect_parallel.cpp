@@ -0,0 +1,92 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_collect_parallel_value) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values(100000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::u32>(index);
+    }
+
+    // clang-format off
+    const auto collected_values = stream(values)
+        .filter(filters::even)
+        .map([](auto value) {
+            return value << 1;
+        })
+        .collect_parallel(4);
+    // clang-format on
+    ASSERT_EQ(collected_values.size(), values.size() >> 1);
+
+    for(kstd::usize index = 0; index < collected_values.size(); ++index) {
+        ASSERT_EQ(collected_values[index], index << 2);
+    }
+}
+
+TEST(kstd_streams_Stream, test_collect_parallel_sorted) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values(50000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::u32>(values.size() - index - 1);
+    }
+
+    const auto collected_values = stream(values).sort().collect_parallel(3);
+    ASSERT_EQ(collected_values.size(), values.size());
+
+    for(kstd::usize index = 0; index < collected_values.size(); ++index) {
+        ASSERT_EQ(collected_values[index], index);
+    }
+}
+
+TEST(kstd_streams_Stream, test_collect_parallel_small) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"Hello"s, "World"s, "OwO"s};
+    const auto collected_values = stream(values).collect_parallel();
+    ASSERT_EQ(collected_values, values);
+}
+
+TEST(kstd_streams_Stream, test_collect_parallel_linked_struct) {
+    using namespace kstd::streams;
+
+    struct Node final {
+        kstd::u32 value;
+        Node* next;
+    };
+
+    Node third {3, nullptr};
+    Node second {2, &third};
+    Node first {1, &second};
+
+    // clang-format off
+    const auto collected_values = stream_until_null(&first, KSTD_PTR_FIELD_FUNCTOR(next))
+        .map(KSTD_FIELD_FUNCTOR(value))
+        .collect_parallel();
+    // clang-format on
+    ASSERT_EQ(collected_values, (std::vector<kstd::u32> {1, 2, 3}));
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_columns_rows) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector names {"Hello"s, "World"s, "OwO"s};
+    std::vector<kstd::u32> latencies {10, 20, 30};
+    stream_columns(names, latencies).for_each([](auto row) {
+        auto& [name, latency] = row;
+        latency += static_cast<kstd::u32>(name.size());
+    });
+    ASSERT_EQ(latencies, (std::vector<kstd::u32> {15, 25, 33}));
+}
+
+TEST(kstd_streams_Stream, test_columns_projection) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u64> ids {1, 2, 3, 4};
+    const std::vector<kstd::f64> latencies {0.5, 1.5, 2.5, 3.5};
+    // clang-format off
+    const auto sum = stream_columns(ids, latencies)
+        .map(mappers::column<1>)
+        .sum();
+    // clang-format on
+    ASSERT_DOUBLE_EQ(sum, 8.0);
+
+    const auto summary = stream_columns(ids, latencies).column<1>().summarize();
+    ASSERT_EQ(summary.count, 4);
+    ASSERT_DOUBLE_EQ(summary.mean, 2.0);
+}
+
+TEST(kstd_streams_Stream, test_columns_filter) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u64> ids {1, 2, 3, 4, 5};
+    const std::vector<kstd::u32> latencies {50, 10, 70, 20, 90};
+    // clang-format off
+    const auto slow_ids = stream_columns(ids, latencies)
+        .filter([](auto row) {
+            return row.template get<1>() > 40;
+        })
+        .map(mappers::column<0>)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(slow_ids, (std::vector<kstd::u64> {1, 3, 5}));
+}
+
+TEST(kstd_streams_Stream, test_columns_parallel) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> ids(100000);
+    std::vector<kstd::u32> values(100000);
+    for(kstd::usize index = 0; index < ids.size(); ++index) {
+        ids[index] = static_cast<kstd::u32>(index);
+        values[index] = static_cast<kstd::u32>(index * 2);
+    }
+
+    // clang-format off
+    const auto collected_values = stream_columns(ids, values)
+        .map([](auto row) {
+            return row.template get<1>() - row.template get<0>();
+        })
+        .collect_parallel(4);
+    // clang-format on
+    ASSERT_EQ(collected_values, ids);
+}
+
+TEST(kstd_streams_Stream, test_columns_spans) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> ids {1, 2, 3, 4};
+    std::vector<kstd::f32> weights {0.5F, 1.0F, 1.5F};
+    // clang-format off
+    const auto sum = stream_columns(std::span {ids}, std::span {weights})
+        .map([](auto row) { return static_cast<kstd::f32>(row.template get<0>()) * row.template get<1>(); })
+        .sum();
+    // clang-format on
+    ASSERT_EQ(sum, 7.0F);
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <vector>
+
+namespace {
+    template<typename T, kstd::usize SIZE>
+    constexpr auto to_array(const std::vector<T>& values) noexcept -> std::array<T, SIZE> {
+        std::array<T, SIZE> result {};
+        for(kstd::usize index = 0; index < SIZE && index < values.size(); ++index) {
+            result[index] = values[index];
+        }
+        return result;
+    }
+
+    constexpr auto sorted_values = []() noexcept {
+        using namespace kstd::streams;
+        const std::array<kstd::u32, 6> values {4, 2, 5, 1, 3, 0};
+        return to_array<kstd::u32, 6>(stream(values).sort().collect<std::vector>(collectors::push_back));
+    }();
+
+    constexpr auto reverse_sorted_values = []() noexcept {
+        using namespace kstd::streams;
+        const std::array<kstd::u32, 6> values {4, 2, 5, 1, 3, 0};
+        return to_array<kstd::u32, 6>(stream(values).reverse_sort().collect<std::vector>(collectors::push_back));
+    }();
+
+    constexpr auto distinct_values = []() noexcept {
+        using namespace kstd::streams;
+        const std::array<kstd::u32, 8> values {3, 1, 3, 2, 1, 4, 4, 3};
+        return to_array<kstd::u32, 4>(stream(values).distinct().collect<std::vector>(collectors::push_back));
+    }();
+
+    constexpr auto squares_table = []() noexcept {
+        using namespace kstd::streams;
+        std::array<kstd::u32, 8> values {};
+        for(kstd::usize index = 0; index < values.size(); ++index) {
+            values[index] = static_cast<kstd::u32>(values.size() - index);
+        }
+        // clang-format off
+        const auto squares = stream(values)
+            .map([](auto value) {
+                return value * value;
+            })
+            .filter(filters::even)
+            .sort()
+            .collect<std::vector>(collectors::push_back);
+        // clang-format on
+        return to_array<kstd::u32, 4>(squares);
+    }();
+}// namespace
+
+TEST(kstd_streams_Stream, test_constexpr_sort) {
+    static_assert(sorted_values == std::array<kstd::u32, 6> {0, 1, 2, 3, 4, 5});
+    static_assert(reverse_sorted_values == std::array<kstd::u32, 6> {5, 4, 3, 2, 1, 0});
+    ASSERT_EQ(sorted_values[5], 5);
+}
+
+TEST(kstd_streams_Stream, test_constexpr_distinct) {
+    static_assert(distinct_values == std::array<kstd::u32, 4> {3, 1, 2, 4});
+    ASSERT_EQ(distinct_values[0], 3);
+    const std::array<kstd::u32, 8> values {3, 1, 3, 2, 1, 4, 4, 3};
+    const auto runtime_values = kstd::streams::stream(values).distinct().collect<std::vector>(
+            kstd::streams::collectors::push_back);
+    ASSERT_EQ(runtime_values, (std::vector<kstd::u32>(distinct_values.cbegin(), distinct_values.cend())));
+}
+
+TEST(kstd_streams_Stream, test_constexpr_pipeline) {
+    static_assert(squares_table == std::array<kstd::u32, 4> {4, 16, 36, 64});
+    static_assert(kstd::streams::stream(squares_table).sum() == 120);
+    static_assert(kstd::streams::stream(squares_table).count() == 4);
+    ASSERT_EQ(squares_table[3], 64);
+}
\ No newline at end of file
@@ -89,4 +89,13 @@ TEST(kstd_streams_Stream, test_distinct_const_pointer) {
 
     ASSERT_TRUE(contains("Hello World"));
     ASSERT_TRUE(contains("!:3"));
+}
+
+TEST(kstd_streams_Stream, test_distinct_order) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"World"s, "Hello"s, "World"s, "!"s, "Hello"s, ":3"s};
+    const auto distinct_values = stream(values).distinct().collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(distinct_values, (std::vector {"World"s, "Hello"s, "!"s, ":3"s}));
 }
\ No newline at end of file
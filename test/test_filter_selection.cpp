@@ -0,0 +1,152 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <vector>
+
+namespace {
+    template<typename PIPE>
+    constexpr bool is_selection_pipe = false;
+
+    template<typename PIPE, typename PREDICATE>
+    constexpr bool is_selection_pipe<kstd::streams::SelectionPipe<PIPE, PREDICATE>> = true;
+}// namespace
+
+TEST(kstd_streams_Stream, test_filter_selection_value) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values(1000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::u32>(index);
+    }
+
+    const auto filtered_values = stream(values).filter(filters::odd).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(filtered_values.size(), values.size() >> 1);
+
+    for(kstd::usize index = 0; index < filtered_values.size(); ++index) {
+        ASSERT_EQ(filtered_values[index], (index << 1) + 1);
+    }
+}
+
+TEST(kstd_streams_Stream, test_filter_selection_reference) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::i64> values {-3, 4, -5, 6, -7};
+    stream(values)
+            .filter([](auto value) {
+                return value < 0;
+            })
+            .for_each([](auto& value) {
+                value = -value;
+            });
+    ASSERT_EQ(values, (std::vector<kstd::i64> {3, 4, 5, 6, 7}));
+}
+
+TEST(kstd_streams_Stream, test_filter_selection_count) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::f32> values(1001);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::f32>(index % 3);
+    }
+
+    const auto count = stream(values).filter(filters::non_zero).count();
+    ASSERT_EQ(count, 667);
+}
+
+TEST(kstd_streams_Stream, test_filter_selection_find_first) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {2, 4, 6, 7, 8, 9};
+    // clang-format off
+    const auto element = stream(values)
+        .filter(filters::odd)
+        .find_first([](auto value) {
+            return value > 7;
+        });
+    // clang-format on
+    ASSERT_TRUE(element);
+    ASSERT_EQ(&(*element), &values[5]);
+}
+
+TEST(kstd_streams_Stream, test_filter_selection_parallel) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u64> values(100000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = index;
+    }
+
+    const auto filtered_values = stream(values).filter(filters::even).collect_parallel(4);
+    ASSERT_EQ(filtered_values.size(), values.size() >> 1);
+
+    for(kstd::usize index = 0; index < filtered_values.size(); ++index) {
+        ASSERT_EQ(filtered_values[index], index << 1);
+    }
+}
+
+TEST(kstd_streams_Stream, test_filter_selection_lazy_predicate) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values(1000, 1);
+    kstd::usize count = 0;
+    // clang-format off
+    const auto element = stream(values)
+        .filter([&count](auto value) {
+            ++count;
+            return value != 0;
+        })
+        .find_first([](auto) {
+            return true;
+        });
+    // clang-format on
+    ASSERT_TRUE(element);
+    ASSERT_EQ(count, 1);
+}
+
+TEST(kstd_streams_Stream, test_filter_selection_predicate) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::i32> values(1000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::i32>(index);
+    }
+
+    const auto count = stream(values).filter(predicates::in_range(100, 199)).count();
+    ASSERT_EQ(count, 100);
+}
+
+TEST(kstd_streams_Stream, test_filter_selection_pure) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values(1000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::u32>(index);
+    }
+
+    auto filtered_stream = stream(values).filter(filters::pure([](kstd::u32 value) { return value % 3 == 0; }));
+    static_assert(is_selection_pipe<typename decltype(filtered_stream)::PipeType>);
+    const auto filtered_values = filtered_stream.collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(filtered_values.size(), 334);
+    for(kstd::usize index = 0; index < filtered_values.size(); ++index) {
+        ASSERT_EQ(filtered_values[index], index * 3);
+    }
+}
\ No newline at end of file
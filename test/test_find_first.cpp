@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 #include <kstd/streams/stream.hpp>
+#include <limits>
+#include <list>
 #include <vector>
 
 TEST(kstd_streams_Stream, test_find_value) {
@@ -34,4 +36,76 @@ TEST(kstd_streams_Stream, test_find_value) {
 
     ASSERT_TRUE(first_value);
     ASSERT_EQ(*first_value, 111);
+}
+
+TEST(kstd_streams_Stream, test_find_first_equal_to) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u8> bytes(1000, 0);
+    bytes[700] = 42;
+    bytes[900] = 42;
+    ASSERT_EQ(stream(bytes).index_of(predicates::equal_to(42)), 700);
+    ASSERT_EQ(stream(bytes).index_of(predicates::equal_to(300)), bytes.size());
+    ASSERT_EQ(&(*stream(bytes).find_first(predicates::equal_to(42))), &bytes[700]);
+
+    std::vector<kstd::u64> values {};
+    for(kstd::u64 index = 0; index < 1000; ++index) {
+        values.push_back(index * 3);
+    }
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(kstd::u64 {2997})), 999);
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(kstd::u64 {2998})), values.size());
+    ASSERT_FALSE(stream(values).find_first(predicates::equal_to(kstd::u64 {1})));
+}
+
+TEST(kstd_streams_Stream, test_find_first_in_range) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::i32> values {};
+    for(kstd::i32 index = 0; index < 1000; ++index) {
+        values.push_back(index - 500);
+    }
+    ASSERT_EQ(*stream(values).find_first(predicates::in_range(-10, -5)), -10);
+    ASSERT_EQ(stream(values).index_of(predicates::in_range(498, 1000)), 998);
+    ASSERT_EQ(stream(values).index_of(predicates::in_range(600, 700)), values.size());
+    ASSERT_EQ(stream(values).index_of(predicates::in_range(5, -5)), values.size());
+
+    const std::vector<kstd::f32> floats {0.5F, 1.5F, 2.5F};
+    ASSERT_EQ(*stream(floats).find_first(predicates::in_range(1.0F, 2.0F)), 1.5F);
+}
+
+TEST(kstd_streams_Stream, test_find_first_in_range_conversions) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {0, 7, 1};
+    const std::list<kstd::u32> list_values {values.cbegin(), values.cend()};
+    ASSERT_EQ(stream(values).index_of(predicates::in_range(0.5, 2.5)), 2);
+    ASSERT_EQ(stream(list_values).index_of(predicates::in_range(0.5, 2.5)), 2);
+    ASSERT_EQ(stream(values).index_of(predicates::in_range(6.5, 1e10)), 1);
+    ASSERT_EQ(stream(values).index_of(predicates::in_range(-0.5, 0.5)), 0);
+
+    const std::vector<kstd::u8> bytes {200, 3, 255};
+    ASSERT_EQ(stream(bytes).index_of(predicates::in_range(256, 1000)), bytes.size());
+    ASSERT_EQ(stream(bytes).index_of(predicates::in_range(-300, 100)), 1);
+    ASSERT_EQ(stream(bytes).index_of(predicates::in_range(250, 300)), 2);
+}
+
+TEST(kstd_streams_Stream, test_find_first_equal_to_conversions) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {0, 7, 4294967295U};
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(1e20)), values.size());
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(4294967296.0)), values.size());
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(-1.0)), values.size());
+    const auto nan = std::numeric_limits<kstd::f64>::quiet_NaN();
+    const auto infinity = std::numeric_limits<kstd::f64>::infinity();
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(nan)), values.size());
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(infinity)), values.size());
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(7.5)), values.size());
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(-0.0)), 0);
+    ASSERT_EQ(stream(values).index_of(predicates::equal_to(4294967295.0)), 2);
+
+    const std::vector<kstd::f32> floats {1.5F, std::numeric_limits<kstd::f32>::infinity()};
+    ASSERT_EQ(stream(floats).index_of(predicates::equal_to(1e300)), floats.size());
+    ASSERT_EQ(stream(floats).index_of(predicates::equal_to(infinity)), 1);
+    ASSERT_EQ(stream(floats).index_of(predicates::equal_to(1.5)), 0);
 }
\ No newline at end of file
@@ -0,0 +1,138 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Event final {
+        kstd::u32 user_id;
+        kstd::u32 value;
+    };
+
+    struct User final {
+        kstd::u32 id;
+        std::string name;
+    };
+}// namespace
+
+TEST(kstd_streams_Stream, test_join) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector<Event> events {{1, 10}, {3, 30}, {2, 20}, {4, 40}, {1, 11}};
+    const std::vector<User> users {{1, "Alice"s}, {2, "Bob"s}, {1, "Alias"s}, {3, "Carol"s}};
+    // clang-format off
+    const auto names = stream(events)
+        .join(stream(users), KSTD_FIELD_FUNCTOR(user_id), KSTD_FIELD_FUNCTOR(id))
+        .map([](auto pair) { return fmt::format("{}:{}", pair.first.value, pair.second.name); })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(names, (std::vector {"10:Alice"s, "10:Alias"s, "30:Carol"s, "20:Bob"s, "11:Alice"s, "11:Alias"s}));
+}
+
+TEST(kstd_streams_Stream, test_join_references_build) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector<kstd::u32> ids {2, 3};
+    const std::vector<User> users {{1, "Alice"s}, {2, "Bob"s}, {3, "Carol"s}};
+    // clang-format off
+    const auto matches = stream(ids)
+        .join(stream(users), [](kstd::u32 id) { return id; }, KSTD_FIELD_FUNCTOR(id))
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(matches.size(), 2);
+    ASSERT_EQ(&matches[0].second, &users[1]);
+    ASSERT_EQ(&matches[1].second, &users[2]);
+}
+
+TEST(kstd_streams_Stream, test_semi_join) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 index = 0; index < 1000; ++index) {
+        values.push_back(index);
+    }
+    const std::vector<kstd::u32> allowed {999, 5, 500, 5, 12345};
+    const auto identity = [](kstd::u32 value) { return value; };
+    // clang-format off
+    const auto matches = stream(values)
+        .semi_join(stream(allowed), identity, identity)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(matches, (std::vector<kstd::u32> {5, 500, 999}));
+}
+
+TEST(kstd_streams_Stream, test_anti_join) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"a"s, "b"s, "c"s, "d"s};
+    const std::vector denied {"b"s, "d"s};
+    const auto identity = [](const std::string& value) -> const std::string& { return value; };
+    // clang-format off
+    const auto matches = stream(values)
+        .anti_join(stream(denied), identity, identity)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(matches, (std::vector {"a"s, "c"s}));
+}
+
+TEST(kstd_streams_Stream, test_join_buffered_build) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector<Event> events {{3, 30}, {1, 10}, {2, 20}};
+    const std::vector<User> users {{3, "Carol"s}, {1, "Alice"s}, {2, "Bob"s}, {1, "Alias"s}};
+    // clang-format off
+    const auto names = stream(events)
+        .join(stream(users).sort_by(KSTD_FIELD_FUNCTOR(name)), KSTD_FIELD_FUNCTOR(user_id), KSTD_FIELD_FUNCTOR(id))
+        .map([](auto pair) { return fmt::format("{}:{}", pair.first.value, pair.second.name); })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(names, (std::vector {"30:Carol"s, "10:Alias"s, "10:Alice"s, "20:Bob"s}));
+
+    const std::vector names_to_keep {"b"s, "a"s, "b"s};
+    const std::vector values {"a"s, "b"s, "c"s};
+    const auto identity = [](const std::string& value) -> const std::string& { return value; };
+    // clang-format off
+    const auto matches = stream(values)
+        .semi_join(stream(names_to_keep).distinct(), identity, identity)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(matches, (std::vector {"a"s, "b"s}));
+}
+
+TEST(kstd_streams_Stream, test_join_signed_zero) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::f64> values {-0.0, 1.0, 2.0};
+    const std::vector<kstd::f64> keys {0.0, 2.0};
+    const auto identity = [](kstd::f64 value) { return value; };
+    // clang-format off
+    const auto matches = stream(values)
+        .semi_join(stream(keys), identity, identity)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(matches, (std::vector<kstd::f64> {-0.0, 2.0}));
+}
\ No newline at end of file
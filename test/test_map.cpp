@@ -17,6 +17,7 @@
  * @since 21/07/2023
  */
 
+#include <fmt/compile.h>
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 #include <kstd/streams/stream.hpp>
@@ -117,4 +118,43 @@ TEST(kstd_streams_Stream, test_map_format_value) {
     for(kstd::usize index = 0; index < num_values; ++index) {
         ASSERT_EQ(mapped_values[index], values[index] + "!");
     }
+}
+
+TEST(kstd_streams_Stream, test_map_format) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector<kstd::u32> values {1, 2, 3};
+    const auto suffix = "!"s;
+    auto mapped_stream = stream(values).map(mappers::format("{x}{suffix}", mappers::arg("suffix", suffix)));
+    // The mapper owns its format and arguments, so the stream outlives the expression which created it
+    const auto mapped_values = mapped_stream.collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(mapped_values, (std::vector {"1!"s, "2!"s, "3!"s}));
+
+    // Values of named arguments are copied, so temporaries don't dangle either
+    auto temporary_stream = stream(values).map(mappers::format("{}{suffix}", mappers::arg("suffix", "?"s)));
+    const auto temporary_values = temporary_stream.collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(temporary_values, (std::vector {"1?"s, "2?"s, "3?"s}));
+}
+
+TEST(kstd_streams_Stream, test_map_format_compiled) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector<kstd::u32> values {1, 22, 333};
+    // clang-format off
+    const auto mapped_values = stream(values)
+        .map(mappers::format(FMT_COMPILE("<{:>3}>")))
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(mapped_values, (std::vector {"<  1>"s, "< 22>"s, "<333>"s}));
+
+    // Both overloads pass the element the same way, so named arguments work with compiled formats too
+    auto named_stream = stream(values).map(mappers::format(FMT_COMPILE("{x}{suffix}"), mappers::arg("suffix", "?"s)));
+    const auto named_values = named_stream.collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(named_values, (std::vector {"1?"s, "22?"s, "333?"s}));
+
+    std::string value {};
+    stream(values).collect_into(value, collectors::format_joining(FMT_COMPILE("{:04}"), ","));
+    ASSERT_EQ(value, "0001,0022,0333");
 }
\ No newline at end of file
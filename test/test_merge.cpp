@@ -0,0 +1,66 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_merge) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> first {1, 4, 7, 10};
+    const std::vector<kstd::u32> second {2, 5, 8};
+    const std::vector<kstd::u32> third {0, 3, 6, 9, 11, 12};
+    // clang-format off
+    const auto merged_values = stream(first)
+        .merge(stream(second), stream(third))
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(merged_values, (std::vector<kstd::u32> {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}));
+}
+
+TEST(kstd_streams_Stream, test_merge_stable) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> first {1, 2, 2};
+    const std::vector<kstd::u32> second {2, 3};
+    // clang-format off
+    const auto merged_values = stream(first)
+        .merge(stream(second))
+        .map([](const kstd::u32& value) { return &value; })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(merged_values, (std::vector<const kstd::u32*> {&first[0], &first[1], &first[2], &second[0], &second[1]}));
+}
+
+TEST(kstd_streams_Stream, test_merge_comparator) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> first {9, 5, 1};
+    const std::list<kstd::u32> second {8, 6, 4, 2};
+    const std::vector<kstd::u32> third {};
+    // clang-format off
+    const auto merged_values = stream(first)
+        .merge(comparators::greater_than, stream(second), stream(third))
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(merged_values, (std::vector<kstd::u32> {9, 8, 6, 5, 4, 2, 1}));
+}
\ No newline at end of file
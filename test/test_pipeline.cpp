@@ -0,0 +1,109 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <optional>
+#include <string>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_pipeline) {
+    using namespace kstd::streams;
+
+    // clang-format off
+    auto odd_squares = pipeline()
+        .filter(filters::odd)
+        .map([](kstd::u32 value) { return value * value; })
+        .reverse_sort();
+    // clang-format on
+
+    const std::vector<kstd::u32> first_batch {1, 2, 3, 4, 5};
+    const std::list<kstd::u32> second_batch {7, 9, 8};
+    ASSERT_EQ(odd_squares(stream(first_batch)).collect<std::vector>(collectors::push_back),
+              (std::vector<kstd::u32> {25, 9, 1}));
+    ASSERT_EQ(odd_squares(stream(second_batch)).collect<std::vector>(collectors::push_back),
+              (std::vector<kstd::u32> {81, 49}));
+}
+
+TEST(kstd_streams_Stream, test_pipeline_reuses_buffers) {
+    using namespace kstd::streams;
+
+    auto sorted = pipeline().sort();
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 index = 0; index < 1000; ++index) {
+        values.push_back(1000 - index);
+    }
+
+    const kstd::u32* first_address = nullptr;
+    sorted(stream(values)).for_each([&first_address](auto& value) {
+        if(first_address == nullptr) {
+            first_address = &value;
+        }
+    });
+    ASSERT_NE(first_address, nullptr);
+
+    // The second run gets the buffer of the first one handed back, so the elements land at the same address
+    const kstd::u32* second_address = nullptr;
+    sorted(stream(values)).for_each([&second_address](auto& value) {
+        if(second_address == nullptr) {
+            second_address = &value;
+        }
+    });
+    ASSERT_EQ(first_address, second_address);
+}
+
+TEST(kstd_streams_Stream, test_pipeline_then) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    // clang-format off
+    auto pipeline_template = pipeline()
+        .distinct()
+        .then([](auto& stream) { return stream.sort_by([](const std::string& value) { return value.size(); }); });
+    // clang-format on
+
+    const std::vector values {"ccc"s, "a"s, "ccc"s, "bb"s, "a"s};
+    ASSERT_EQ(pipeline_template(stream(values)).collect<std::vector>(collectors::push_back),
+              (std::vector {"a"s, "bb"s, "ccc"s}));
+    ASSERT_EQ(pipeline_template(stream(values)).count(), 3);
+}
+
+TEST(kstd_streams_Stream, test_pipeline_buffer_copy) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {3, 1, 2};
+    std::vector<kstd::u32> storage {};
+    const auto callback = [](std::vector<kstd::u32>& buffer) noexcept {
+        std::sort(buffer.begin(), buffer.end());
+    };
+    using Pipe = BufferedPipe<IteratorPipe<std::vector<kstd::u32>::const_iterator>, decltype(callback)>;
+
+    std::optional<Pipe> original {std::in_place, IteratorPipe {values.cbegin(), values.cend()}, callback, "sort",
+                                  &storage};
+    ASSERT_EQ(*original->get_next(), 1);
+    Pipe copy {*original};
+    original.reset();// Hands the original buffer back to the storage, which is then reused
+    storage.assign(values.size(), 0);
+
+    ASSERT_EQ(*copy.get_next(), 2);
+    ASSERT_EQ(*copy.get_next(), 3);
+    ASSERT_FALSE(copy.get_next());
+}
\ No newline at end of file
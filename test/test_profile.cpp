@@ -0,0 +1,93 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_profile_disabled) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5, 6};
+    // clang-format off
+    const auto sum = stream(values)
+        .filter(filters::even)
+        .profile<false>("filter")
+        .sum();
+    // clang-format on
+    ASSERT_EQ(sum, 12);
+}
+
+TEST(kstd_streams_Stream, test_profile_counts) {
+    using namespace kstd::streams;
+
+    profiling::reset();
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    // clang-format off
+    const auto sum = stream(values)
+        .profile<true>("test_profile_source")
+        .filter(filters::even)
+        .profile<true>("test_profile_filter")
+        .map([](auto value) {
+            return value << 1;
+        })
+        .profile<true>("test_profile_map")
+        .sum();
+    // clang-format on
+    ASSERT_EQ(sum, 60);
+
+    const auto report = profiling::get_report();
+    ASSERT_EQ(report.size(), 3);
+
+    ASSERT_EQ(report[0].name, "test_profile_map");
+    ASSERT_EQ(report[0].elements_in, 5);
+    ASSERT_EQ(report[0].elements_out, 5);
+
+    ASSERT_EQ(report[1].name, "test_profile_filter");
+    ASSERT_EQ(report[1].elements_in, 10);
+    ASSERT_EQ(report[1].elements_out, 5);
+
+    ASSERT_EQ(report[2].name, "test_profile_source");
+    ASSERT_EQ(report[2].elements_in, 10);
+    ASSERT_EQ(report[2].elements_out, 10);
+
+    for(const auto& stage : report) {
+        ASSERT_LE(stage.exclusive_time, stage.inclusive_time);
+    }
+    ASSERT_NE(profiling::format_report().find("test_profile_filter"), std::string::npos);
+}
+
+TEST(kstd_streams_Stream, test_profile_parallel) {
+    using namespace kstd::streams;
+
+    profiling::reset();
+    std::vector<kstd::u32> values(100000, 1);
+    // clang-format off
+    const auto collected_values = stream(values)
+        .profile<true>("test_profile_parallel")
+        .collect_parallel(4);
+    // clang-format on
+    ASSERT_EQ(collected_values.size(), values.size());
+
+    const auto report = profiling::get_report();
+    ASSERT_EQ(report.size(), 1);
+    ASSERT_EQ(report[0].elements_in, values.size());
+    ASSERT_EQ(report[0].elements_out, values.size());
+}
\ No newline at end of file
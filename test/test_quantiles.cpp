@@ -0,0 +1,90 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <random>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_quantile) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {9, 1, 8, 2, 7, 3, 6, 4, 5, 0};
+    ASSERT_EQ(*stream(values).quantile(0.0), 0);
+    ASSERT_EQ(*stream(values).quantile(0.5), 5);
+    ASSERT_EQ(*stream(values).quantile(0.99), 9);
+    ASSERT_EQ(*stream(values).quantile(1.0), 9);
+    ASSERT_FALSE(stream(std::vector<kstd::u32> {}).quantile(0.5));
+}
+
+TEST(kstd_streams_Stream, test_approx_quantiles) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 index = 0; index < 100000; ++index) {
+        values.push_back(index);
+    }
+    std::shuffle(values.begin(), values.end(), std::mt19937 {1234});
+
+    const auto quantiles = stream(values).approx_quantiles({0.5, 0.9, 0.99});
+    ASSERT_EQ(quantiles.size(), 3);
+    ASSERT_NEAR(static_cast<kstd::f64>(quantiles[0]), 50000.0, 2000.0);
+    ASSERT_NEAR(static_cast<kstd::f64>(quantiles[1]), 90000.0, 2000.0);
+    ASSERT_NEAR(static_cast<kstd::f64>(quantiles[2]), 99000.0, 2000.0);
+}
+
+TEST(kstd_streams_Stream, test_quantile_sketch_merge) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::f64> lhs {};
+    std::vector<kstd::f64> rhs {};
+    for(kstd::u32 index = 0; index < 50000; ++index) {
+        lhs.push_back(static_cast<kstd::f64>(index));
+        rhs.push_back(static_cast<kstd::f64>(index + 50000));
+    }
+
+    auto sketch = stream(lhs).quantile_sketch();
+    sketch.merge(stream(rhs).quantile_sketch());
+    ASSERT_EQ(sketch.get_count(), 100000);
+    ASSERT_LT(sketch.get_retained_count(), 1000);
+    ASSERT_NEAR(*sketch.get_quantile(0.25), 25000.0, 2000.0);
+    ASSERT_NEAR(*sketch.get_quantile(0.75), 75000.0, 2000.0);
+}
+
+TEST(kstd_streams_Stream, test_quantile_sketch_weight) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 index = 0; index < 10007; ++index) {
+        values.push_back(index);
+    }
+
+    // Small levels compact often and with odd item counts
+    auto sketch = stream(values).quantile_sketch(8, 42);
+    ASSERT_EQ(sketch.get_weight(), sketch.get_count());
+    sketch.merge(stream(values).quantile_sketch(8, 43));
+    ASSERT_EQ(sketch.get_count(), values.size() << 1);
+    ASSERT_EQ(sketch.get_weight(), sketch.get_count());
+
+    const auto lhs = stream(values).approx_quantiles({0.1, 0.5, 0.9}, 8, 7);
+    const auto rhs = stream(values).approx_quantiles({0.1, 0.5, 0.9}, 8, 7);
+    ASSERT_EQ(lhs, rhs);
+}
\ No newline at end of file
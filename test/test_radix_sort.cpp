@@ -0,0 +1,102 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <algorithm>
+#include <functional>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    template<typename T>
+    auto make_values(kstd::usize count) noexcept -> std::vector<T> {
+        std::vector<T> values(count);
+        kstd::u64 state = 0x9E3779B97F4A7C15ULL;
+        for(auto& value : values) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            if constexpr(std::is_floating_point_v<T>) {
+                value = static_cast<T>(static_cast<kstd::i64>(state)) / static_cast<T>(1e12);
+            }
+            else {
+                value = static_cast<T>(state);
+            }
+        }
+        return values;
+    }
+
+    template<typename T>
+    auto check_sort() noexcept -> void {
+        using namespace kstd::streams;
+
+        const auto values = make_values<T>(5000);
+        auto expected_values = values;
+        std::sort(expected_values.begin(), expected_values.end());
+        ASSERT_EQ(stream(values).sort().template collect<std::vector>(collectors::push_back), expected_values);
+
+        std::sort(expected_values.begin(), expected_values.end(), std::greater<> {});
+        ASSERT_EQ(stream(values).reverse_sort().template collect<std::vector>(collectors::push_back), expected_values);
+    }
+}// namespace
+
+TEST(kstd_streams_Stream, test_radix_sort_unsigned) {
+    check_sort<kstd::u32>();
+    check_sort<kstd::u64>();
+    check_sort<kstd::u8>();
+}
+
+TEST(kstd_streams_Stream, test_radix_sort_signed) {
+    check_sort<kstd::i64>();
+    check_sort<kstd::i16>();
+}
+
+TEST(kstd_streams_Stream, test_radix_sort_floating_point) {
+    check_sort<kstd::f32>();
+    check_sort<kstd::f64>();
+}
+
+TEST(kstd_streams_Stream, test_sort_by_key) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    struct Event final {
+        kstd::i64 timestamp;
+        std::string name;
+    };
+
+    const std::vector<Event> events {{30, "C"s}, {-10, "A"s}, {20, "B"s}, {-10, "A2"s}, {50, "D"s}};
+    // clang-format off
+    const auto names = stream(events)
+        .sort_by_key(KSTD_FIELD_FUNCTOR(timestamp))
+        .map(KSTD_FIELD_FUNCTOR(name))
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(names, (std::vector {"A"s, "A2"s, "B"s, "C"s, "D"s}));
+
+    // clang-format off
+    const auto reverse_names = stream(events)
+        .reverse_sort_by_key(KSTD_FIELD_FUNCTOR(timestamp))
+        .map(KSTD_FIELD_FUNCTOR(name))
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(reverse_names, (std::vector {"D"s, "C"s, "B"s, "A"s, "A2"s}));
+}
\ No newline at end of file
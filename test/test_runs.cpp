@@ -0,0 +1,60 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_distinct_sorted) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 1, 2, 3, 3, 3, 4, 5, 5};
+    const auto distinct_values = stream(values).distinct_sorted().collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(distinct_values, (std::vector<kstd::u32> {1, 2, 3, 4, 5}));
+}
+
+TEST(kstd_streams_Stream, test_distinct_sorted_after_sort) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"b"s, "a"s, "c"s, "a"s, "b"s};
+    // clang-format off
+    const auto distinct_values = stream(values)
+        .sort()
+        .distinct_sorted()
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(distinct_values, (std::vector {"a"s, "b"s, "c"s}));
+}
+
+TEST(kstd_streams_Stream, test_group_runs) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"apple"s, "avocado"s, "banana"s, "cherry"s, "cranberry"s, "currant"s, "apricot"s};
+    // clang-format off
+    const auto runs = stream(values)
+        .group_runs([](const std::string& value) { return value.front(); })
+        .map([](auto run) { return fmt::format("{}{}", run.first, run.second); })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(runs, (std::vector {"a2"s, "b1"s, "c3"s, "a1"s}));
+}
\ No newline at end of file
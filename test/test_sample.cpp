@@ -0,0 +1,75 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_sample) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 index = 0; index < 100000; ++index) {
+        values.push_back(index);
+    }
+
+    auto samples = stream(values).sample(1000, 1234);
+    ASSERT_EQ(samples.size(), 1000);
+    std::sort(samples.begin(), samples.end());
+    ASSERT_EQ(std::adjacent_find(samples.begin(), samples.end()), samples.end());
+
+    // Every element should be equally likely, so the mean should be close to the middle of the input
+    kstd::f64 sum = 0.0;
+    for(const auto sample : samples) {
+        sum += static_cast<kstd::f64>(sample);
+    }
+    ASSERT_NEAR(sum / static_cast<kstd::f64>(samples.size()), 50000.0, 5000.0);
+    ASSERT_EQ(stream(values).sample(1000, 1234), stream(values).sample(1000, 1234));
+}
+
+TEST(kstd_streams_Stream, test_sample_short) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3};
+    ASSERT_EQ(stream(values).sample(10), values);
+    ASSERT_TRUE(stream(values).sample(0).empty());
+}
+
+TEST(kstd_streams_Stream, test_sample_fraction) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 index = 0; index < 100000; ++index) {
+        values.push_back(index);
+    }
+    const std::list<kstd::u32> list_values {values.begin(), values.end()};
+
+    const auto samples = stream(values).sample_fraction(0.1, 42).collect<std::vector>(collectors::push_back);
+    ASSERT_NEAR(static_cast<kstd::f64>(samples.size()), 10000.0, 500.0);
+    ASSERT_TRUE(std::is_sorted(samples.begin(), samples.end()));
+
+    const auto list_samples = stream(list_values).sample_fraction(0.1, 42).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(samples, list_samples);
+
+    ASSERT_EQ(stream(values).sample_fraction(0.0).count(), 0);
+    ASSERT_EQ(stream(values).sample_fraction(1.0).count(), values.size());
+}
\ No newline at end of file
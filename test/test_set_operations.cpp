@@ -0,0 +1,80 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <list>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_intersect_sorted) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> lhs {1, 2, 2, 3, 5, 8, 13};
+    const std::list<kstd::u32> rhs {2, 2, 2, 4, 5, 13, 21};
+    const auto values = stream(lhs).intersect_sorted(stream(rhs)).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(values, (std::vector<kstd::u32> {2, 2, 5, 13}));
+}
+
+TEST(kstd_streams_Stream, test_intersect_sorted_gallop) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> postings {};
+    for(kstd::u32 index = 0; index < 100000; ++index) {
+        postings.push_back(index * 3);
+    }
+    const std::vector<kstd::u32> query {0, 9, 10, 3000, 299997, 299998, 400000};
+    const auto values = stream(query).intersect_sorted(stream(postings)).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(values, (std::vector<kstd::u32> {0, 9, 3000, 299997}));
+}
+
+TEST(kstd_streams_Stream, test_union_sorted) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> lhs {1, 2, 2, 5};
+    const std::vector<kstd::u32> rhs {0, 2, 3, 5, 5, 9};
+    const auto values = stream(lhs).union_sorted(stream(rhs)).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(values, (std::vector<kstd::u32> {0, 1, 2, 2, 3, 5, 5, 9}));
+}
+
+TEST(kstd_streams_Stream, test_difference_sorted) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> lhs {9, 7, 7, 5, 3, 1};
+    const std::vector<kstd::u32> rhs {8, 7, 6, 6, 4, 4, 2, 2, 0};
+    // clang-format off
+    const auto values = stream(lhs)
+        .difference_sorted(stream(rhs), comparators::greater_than)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(values, (std::vector<kstd::u32> {9, 7, 5, 3, 1}));
+}
+
+TEST(kstd_streams_Stream, test_union_sorted_mixed_references) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    std::vector lhs {"apple"s, "cherry"s, "plum"s};
+    const std::vector rhs {"banana"s, "cherry"s, "kiwi"s};
+    const auto lhs_copy = lhs;
+    const auto values = stream(lhs).union_sorted(stream(rhs)).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(values, (std::vector {"apple"s, "banana"s, "cherry"s, "kiwi"s, "plum"s}));
+    ASSERT_EQ(lhs, lhs_copy);
+}
\ No newline at end of file
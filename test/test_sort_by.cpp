@@ -0,0 +1,82 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_sort_by_value) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"ccc"s, "a"s, "dddd"s, "bb"s, "e"s};
+    kstd::usize key_count = 0;
+    // clang-format off
+    const auto sorted_values = stream(values)
+        .sort_by([&key_count](const std::string& value) {
+            ++key_count;
+            return value.size();
+        })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(key_count, values.size());
+    ASSERT_EQ(sorted_values, (std::vector {"a"s, "e"s, "bb"s, "ccc"s, "dddd"s}));
+}
+
+TEST(kstd_streams_Stream, test_sort_by_string_key) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"World"s, "hello"s, "Apple"s, "banana"s};
+    // clang-format off
+    const auto sorted_values = stream(values)
+        .sort_by([](const std::string& value) {
+            std::string key {value};
+            for(auto& character : key) {
+                character = static_cast<char>(std::tolower(character));
+            }
+            return key;
+        })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(sorted_values, (std::vector {"Apple"s, "banana"s, "hello"s, "World"s}));
+}
+
+TEST(kstd_streams_Stream, test_reverse_sort_by_pointer) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {4, 5, 6, 1, 3, 2, 8, 7, 0, 9};
+    std::vector<kstd::u32*> addresses {};
+    for(auto& value : values) {
+        addresses.push_back(&value);
+    }
+
+    // clang-format off
+    const auto sorted_values = stream(addresses)
+        .reverse_sort_by(mappers::dereference)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(sorted_values.size(), values.size());
+
+    for(kstd::usize index = 0; index < sorted_values.size(); ++index) {
+        ASSERT_EQ(*sorted_values[index], values.size() - index - 1);
+    }
+}
\ No newline at end of file
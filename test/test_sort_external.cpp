@@ -0,0 +1,197 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+struct StringSerializer final {
+    auto write(std::FILE* file, const std::string* values, kstd::usize count) const noexcept -> bool {
+        for(kstd::usize index = 0; index < count; ++index) {
+            const auto size = values[index].size();
+            if(std::fwrite(&size, sizeof(size), 1, file) != 1 ||
+               std::fwrite(values[index].data(), 1, size, file) != size) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto read(std::FILE* file, std::string* values, kstd::usize count) const noexcept -> kstd::Option<kstd::usize> {
+        for(kstd::usize index = 0; index < count; ++index) {
+            kstd::usize size = 0;
+            if(std::fread(&size, sizeof(size), 1, file) != 1) {
+                return index;
+            }
+            values[index].resize(size);
+            if(std::fread(values[index].data(), 1, size, file) != size) {
+                return {};
+            }
+        }
+        return count;
+    }
+};
+
+struct FailingSerializer final {
+    auto write(std::FILE*, const kstd::u32*, kstd::usize) const noexcept -> bool {
+        return false;
+    }
+
+    auto read(std::FILE*, kstd::u32*, kstd::usize) const noexcept -> kstd::Option<kstd::usize> {
+        return {};
+    }
+};
+
+// Writes runs intact, but can't decode them again without the file reporting an error
+struct CorruptSerializer final {
+    auto write(std::FILE* file, const kstd::u32* values, kstd::usize count) const noexcept -> bool {
+        return kstd::streams::serializers::trivial.write(file, values, count);
+    }
+
+    auto read(std::FILE*, kstd::u32*, kstd::usize) const noexcept -> kstd::Option<kstd::usize> {
+        return {};
+    }
+};
+
+// Stops reading after a single value although the run continues
+struct ShortSerializer final {
+    auto write(std::FILE* file, const kstd::u32* values, kstd::usize count) const noexcept -> bool {
+        return kstd::streams::serializers::trivial.write(file, values, count);
+    }
+
+    auto read(std::FILE* file, kstd::u32* values, kstd::usize count) const noexcept -> kstd::Option<kstd::usize> {
+        return kstd::streams::serializers::trivial.read(file, values, std::min<kstd::usize>(count, 1));
+    }
+};
+
+TEST(kstd_streams_Stream, test_sort_external_value) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values(1000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::u32>((index * 7919) % values.size());
+    }
+
+    // clang-format off
+    const auto sorted_values = stream(values)
+        .sort_external(16 * sizeof(kstd::u32))
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(sorted_values.size(), values.size());
+
+    for(kstd::usize index = 0; index < sorted_values.size(); ++index) {
+        ASSERT_EQ(sorted_values[index], index);
+    }
+}
+
+TEST(kstd_streams_Stream, test_sort_external_comparator) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {4, 5, 6, 1, 3, 2, 8, 7, 0, 9};
+    const auto num_values = values.size();
+    // clang-format off
+    const auto sorted_values = stream(values)
+        .sort_external(3 * sizeof(kstd::u32), std::greater<> {})
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(sorted_values.size(), num_values);
+
+    for(kstd::usize index = 0; index < num_values; ++index) {
+        ASSERT_EQ(sorted_values[index], num_values - index - 1);
+    }
+}
+
+TEST(kstd_streams_Stream, test_sort_external_serializer) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"Hello"s, "World"s, "OwO"s, "Test"s, "A"s, ""s, "Zebra"s};
+    // clang-format off
+    const auto sorted_values = stream(values)
+        .sort_external(2 * sizeof(std::string), std::less<> {}, StringSerializer {})
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+
+    auto expected_values = values;
+    std::sort(expected_values.begin(), expected_values.end());
+    ASSERT_EQ(sorted_values, expected_values);
+}
+
+TEST(kstd_streams_Stream, test_sort_external_in_memory) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {4, 5, 6, 1, 3, 2, 8, 7, 0, 9};
+    const auto sorted_values = stream(values).sort_external(1024 * 1024).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(sorted_values.size(), values.size());
+
+    for(kstd::usize index = 0; index < sorted_values.size(); ++index) {
+        ASSERT_EQ(sorted_values[index], index);
+    }
+}
+
+TEST(kstd_streams_Stream, test_sort_external_failed) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {4, 5, 6, 1, 3, 2, 8, 7, 0, 9};
+    bool failed = false;
+    // clang-format off
+    const auto sorted_values = stream(values)
+        .sort_external(3 * sizeof(kstd::u32), comparators::less_than, FailingSerializer {}, &failed)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_TRUE(failed);
+    ASSERT_TRUE(sorted_values.empty());
+
+    failed = false;
+    // clang-format off
+    const auto in_memory_values = stream(values)
+        .sort_external(1024, comparators::less_than, FailingSerializer {}, &failed)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_FALSE(failed);
+    ASSERT_EQ(in_memory_values.size(), values.size());
+}
+
+TEST(kstd_streams_Stream, test_sort_external_read_failed) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {4, 5, 6, 1, 3, 2, 8, 7, 0, 9};
+    bool failed = false;
+    // clang-format off
+    const auto corrupt_values = stream(values)
+        .sort_external(3 * sizeof(kstd::u32), comparators::less_than, CorruptSerializer {}, &failed)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_TRUE(failed);
+    ASSERT_LT(corrupt_values.size(), values.size());
+
+    failed = false;
+    // clang-format off
+    const auto short_values = stream(values)
+        .sort_external(6 * sizeof(kstd::u32), comparators::less_than, ShortSerializer {}, &failed)
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_TRUE(failed);
+    ASSERT_LT(short_values.size(), values.size());
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_summarize_contiguous) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::i32> values(5000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::i32>(index) - 1000;
+    }
+
+    const auto summary = stream(values).summarize();
+    ASSERT_EQ(summary.count, values.size());
+    ASSERT_EQ(summary.sum, 7497500);
+    ASSERT_EQ(summary.min, -1000);
+    ASSERT_EQ(summary.max, 3999);
+    ASSERT_DOUBLE_EQ(summary.mean, 1499.5);
+    ASSERT_NEAR(summary.get_variance(), 2083333.25, 1e-6);
+}
+
+TEST(kstd_streams_Stream, test_summarize_filtered) {
+    using namespace kstd::streams;
+
+    const std::list<kstd::u32> values {1, 2, 3, 4, 5, 6, 7, 8};
+    const auto summary = stream(values).filter(filters::even).summarize();
+    ASSERT_EQ(summary.count, 4);
+    ASSERT_EQ(summary.sum, 20);
+    ASSERT_EQ(summary.min, 2);
+    ASSERT_EQ(summary.max, 8);
+    ASSERT_DOUBLE_EQ(summary.mean, 5.0);
+    ASSERT_DOUBLE_EQ(summary.get_variance(), 5.0);
+    ASSERT_NEAR(summary.get_sample_variance(), 20.0 / 3.0, 1e-12);
+}
+
+TEST(kstd_streams_Stream, test_summarize_stable) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::f64> values(10000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = 1e9 + static_cast<kstd::f64>(index % 2);
+    }
+
+    const auto contiguous_summary = stream(values).summarize();
+    ASSERT_DOUBLE_EQ(contiguous_summary.mean, 1e9 + 0.5);
+    ASSERT_NEAR(contiguous_summary.get_variance(), 0.25, 1e-9);
+
+    const auto online_summary = stream(values).filter(filters::non_zero).summarize();
+    ASSERT_DOUBLE_EQ(online_summary.mean, 1e9 + 0.5);
+    ASSERT_NEAR(online_summary.get_variance(), 0.25, 1e-9);
+}
+
+TEST(kstd_streams_Stream, test_summarize_empty) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::f32> values {};
+    const auto summary = stream(values).summarize();
+    ASSERT_EQ(summary.count, 0);
+    ASSERT_EQ(summary.get_variance(), 0.0);
+}
\ No newline at end of file
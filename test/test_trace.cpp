@@ -0,0 +1,71 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_trace_events) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5, 6};
+    const auto path = testing::TempDir() + "kstd_streams_trace.json";
+
+    tracing::start();
+    {
+        const tracing::Scope<true> scope {"test_trace_outer", "test"};
+        const tracing::Scope<true> nested_scope {"test_trace_inner", "test"};
+        ASSERT_EQ(stream(values).filter(filters::even).sum(), 12);
+    }
+    ASSERT_TRUE(tracing::stop(path.c_str()));
+    ASSERT_FALSE(tracing::is_recording());
+
+    std::ifstream file {path};
+    std::stringstream contents {};
+    contents << file.rdbuf();
+    const auto json = contents.str();
+    std::remove(path.c_str());
+
+    ASSERT_EQ(json.rfind("{\"traceEvents\":[", 0), 0);
+    ASSERT_NE(json.find("{\"name\":\"test_trace_outer\",\"cat\":\"test\",\"ph\":\"B\""), std::string::npos);
+    ASSERT_NE(json.find("{\"name\":\"test_trace_inner\",\"cat\":\"test\",\"ph\":\"E\""), std::string::npos);
+    ASSERT_LT(json.find("\"test_trace_outer\""), json.find("\"test_trace_inner\""));
+}
+
+TEST(kstd_streams_Stream, test_trace_not_recording) {
+    using namespace kstd::streams;
+
+    const auto path = testing::TempDir() + "kstd_streams_trace_empty.json";
+    {
+        const tracing::Scope<true> scope {"test_trace_ignored", "test"};
+    }
+    tracing::start();
+    ASSERT_TRUE(tracing::stop(path.c_str()));
+
+    std::ifstream file {path};
+    std::stringstream contents {};
+    contents << file.rdbuf();
+    std::remove(path.c_str());
+    ASSERT_EQ(contents.str().find("test_trace_ignored"), std::string::npos);
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <numeric>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_chunk_contiguous) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5, 6, 7};
+    kstd::usize offset = 0;
+    stream(values).chunk(3).for_each([&values, &offset](auto chunk) {
+        ASSERT_EQ(chunk.data(), values.data() + offset);
+        ASSERT_EQ(chunk.size(), std::min<kstd::usize>(3, values.size() - offset));
+        offset += chunk.size();
+    });
+    ASSERT_EQ(offset, values.size());
+}
+
+TEST(kstd_streams_Stream, test_chunk_buffered) {
+    using namespace kstd::streams;
+
+    const std::list<kstd::u32> values {1, 2, 3, 4, 5, 6, 7};
+    // clang-format off
+    const auto sums = stream(values)
+        .chunk(3)
+        .map([](auto chunk) {
+            return std::accumulate(chunk.begin(), chunk.end(), 0U);
+        })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(sums, (std::vector<kstd::u32> {6, 15, 7}));
+}
+
+TEST(kstd_streams_Stream, test_window_contiguous) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5, 6, 7};
+    // clang-format off
+    const auto sums = stream(values)
+        .window(3)
+        .map([](auto window) {
+            return std::accumulate(window.begin(), window.end(), 0U);
+        })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(sums, (std::vector<kstd::u32> {6, 9, 12, 15, 18}));
+}
+
+TEST(kstd_streams_Stream, test_window_buffered) {
+    using namespace kstd::streams;
+
+    std::list<kstd::u32> values(100);
+    std::iota(values.begin(), values.end(), 0U);
+    std::vector<kstd::u32> expected_sums {};
+    for(kstd::u32 index = 0; index + 4 <= 100; index += 3) {
+        expected_sums.push_back((index * 4) + 6);
+    }
+
+    const kstd::u32* buffer = nullptr;
+    // clang-format off
+    const auto sums = stream(values)
+        .window(4, 3)
+        .peek([&buffer](auto window) {
+            if(buffer == nullptr) {
+                buffer = window.data();
+            }
+            ASSERT_GE(window.data(), buffer);
+            ASSERT_LE(window.data() + window.size(), buffer + 8);
+        })
+        .map([](auto window) {
+            return std::accumulate(window.begin(), window.end(), 0U);
+        })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(sums, expected_sums);
+}
+
+TEST(kstd_streams_Stream, test_window_large_step) {
+    using namespace kstd::streams;
+
+    const std::list<kstd::u32> values {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    // clang-format off
+    const auto firsts = stream(values)
+        .window(2, 4)
+        .map([](auto window) {
+            return window.front();
+        })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(firsts, (std::vector<kstd::u32> {1, 5, 9}));
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_zip_value) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector keys {"Hello"s, "World"s, "OwO"s};
+    const std::vector<kstd::u32> values {1, 2, 3, 4};
+    const auto zipped_values = stream(keys).zip(stream(values)).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(zipped_values.size(), keys.size());
+
+    for(kstd::usize index = 0; index < zipped_values.size(); ++index) {
+        ASSERT_EQ(&zipped_values[index].first, &keys[index]);
+        ASSERT_EQ(&zipped_values[index].second, &values[index]);
+    }
+}
+
+TEST(kstd_streams_Stream, test_zip_reference) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> lhs {1, 2, 3};
+    const std::vector<kstd::u32> rhs {10, 20, 30};
+    stream(lhs).zip(stream(rhs)).for_each([](auto value) {
+        value.first += value.second;
+    });
+
+    ASSERT_EQ(lhs, (std::vector<kstd::u32> {11, 22, 33}));
+}
+
+TEST(kstd_streams_Stream, test_enumerate_value) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"Hello"s, "World"s, "OwO"s};
+    kstd::usize expected_index = 0;
+    stream(values).enumerate().for_each([&values, &expected_index](auto value) {
+        const auto& [index, element] = value;
+        ASSERT_EQ(index, expected_index);
+        ASSERT_EQ(&element, &values[index]);
+        ++expected_index;
+    });
+    ASSERT_EQ(expected_index, values.size());
+}
+
+TEST(kstd_streams_Stream, test_enumerate_filtered) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5, 6};
+    // clang-format off
+    const auto indices = stream(values)
+        .filter(filters::even)
+        .enumerate(1)
+        .map([](auto value) {
+            return value.first;
+        })
+        .collect<std::vector>(collectors::push_back);
+    // clang-format on
+    ASSERT_EQ(indices, (std::vector<kstd::usize> {1, 2, 3}));
+}
+
+TEST(kstd_streams_Stream, test_enumerate_parallel) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values(100000);
+    for(kstd::usize index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<kstd::u32>(index * 3);
+    }
+
+    // clang-format off
+    const auto collected_values = stream(values)
+        .enumerate()
+        .zip(stream(values))
+        .filter([](auto value) {
+            return value.first.first % 2 == 0;
+        })
+        .map([](auto value) {
+            return value.first.second + value.second - value.first.first;
+        })
+        .collect_parallel(4);
+    // clang-format on
+    ASSERT_EQ(collected_values.size(), values.size() >> 1);
+
+    for(kstd::usize index = 0; index < collected_values.size(); ++index) {
+        ASSERT_EQ(collected_values[index], (index << 1) * 5);
+    }
+}
\ No newline at end of file